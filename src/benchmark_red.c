@@ -0,0 +1,455 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mpi_simulado.h"
+#include "matrix_ops.h"
+#include "mpi_ops.h"
+#include "modelo_costos.h"
+
+
+// ============================================================================
+// CONFIGURACIÓN DE LAS MICRO-PRUEBAS
+// ============================================================================
+#define REPETICIONES_PING_PONG 50
+#define REPETICIONES_COLECTIVAS 10
+#define BYTES_MINIMOS 8
+#define BYTES_MAXIMOS (4 * 1024 * 1024)
+#define ELEMENTOS_STREAM (4 * 1024 * 1024)
+#define REPETICIONES_STREAM 5
+#define TAMANIO_KERNEL 256
+#define TAG_PING_PONG 100
+#define REPETICIONES_VENTANA 10
+
+
+static void* reservar_o_abortar(size_t bytes, int rango) {
+   void* buffer = malloc(bytes > 0 ? bytes : 1);
+   if (!buffer) {
+       fprintf(stderr, "Proceso %d: Error en asignación de memoria\n", rango);
+       MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+   }
+   return buffer;
+}
+
+
+// ============================================================================
+// RED - Ping-pong entre los procesos 0 y 1
+// ============================================================================
+
+/**
+ * Mide la mitad del tiempo de ida y vuelta para mensajes de tamaño creciente
+ * y ajusta t(m) = alfa + m * beta: alfa es el tiempo del mensaje más pequeño
+ * y beta la pendiente por mínimos cuadrados con ordenada fija en alfa.
+ */
+static void medir_ping_pong(ModeloCostos* modelo, int rango, int tamano) {
+   if (tamano < 2) {
+       if (rango == 0) {
+           printf("\n=== PING-PONG ===\n");
+           printf("Se necesita al menos 2 procesos: alfa = beta = 0\n");
+       }
+       modelo->alfa = 0.0;
+       modelo->beta = 0.0;
+       return;
+   }
+
+   char* buffer = (char*)reservar_o_abortar(BYTES_MAXIMOS, rango);
+   memset(buffer, 0, BYTES_MAXIMOS);
+
+   double alfa = 0.0;
+   double suma_tm = 0.0;
+   double suma_mm = 0.0;
+
+   if (rango == 0) {
+       printf("\n=== PING-PONG (procesos 0 <-> 1) ===\n");
+       printf("%12s %14s %14s\n", "Bytes", "Tiempo (us)", "MB/s");
+   }
+
+   for (int bytes = BYTES_MINIMOS; bytes <= BYTES_MAXIMOS; bytes *= 4) {
+       MPI_Barrier(MPI_COMM_WORLD);
+       double inicio = MPI_Wtime();
+       for (int r = 0; r < REPETICIONES_PING_PONG; r++) {
+           if (rango == 0) {
+               MPI_Send(buffer, bytes, MPI_CHAR, 1, TAG_PING_PONG, MPI_COMM_WORLD);
+               MPI_Recv(buffer, bytes, MPI_CHAR, 1, TAG_PING_PONG, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+           } else if (rango == 1) {
+               MPI_Recv(buffer, bytes, MPI_CHAR, 0, TAG_PING_PONG, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+               MPI_Send(buffer, bytes, MPI_CHAR, 0, TAG_PING_PONG, MPI_COMM_WORLD);
+           }
+       }
+       double t = (MPI_Wtime() - inicio) / (2.0 * REPETICIONES_PING_PONG);
+
+       if (rango == 0) {
+           printf("%12d %14.2f %14.2f\n", bytes, t * 1e6, bytes / t / 1e6);
+           if (bytes == BYTES_MINIMOS) {
+               alfa = t;
+           } else {
+               suma_tm += (t - alfa) * bytes;
+               suma_mm += (double)bytes * bytes;
+           }
+       }
+   }
+
+   modelo->alfa = alfa;
+   modelo->beta = (suma_mm > 0.0 && suma_tm > 0.0) ? suma_tm / suma_mm : 0.0;
+   MPI_Bcast(&modelo->alfa, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+   MPI_Bcast(&modelo->beta, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+
+   if (rango == 0) {
+       printf("alfa = %.2f us, beta = %.4f ns/B (%.2f MB/s)\n",
+              modelo->alfa * 1e6, modelo->beta * 1e9,
+              modelo->beta > 0.0 ? 1.0 / modelo->beta / 1e6 : 0.0);
+   }
+
+   free(buffer);
+}
+
+
+// ============================================================================
+// RED - Barrido de colectivas por tamaño de mensaje y número de procesos
+// ============================================================================
+
+typedef enum { COLECTIVA_BCAST, COLECTIVA_SCATTERV, COLECTIVA_GATHERV, COLECTIVA_REDUCE } Colectiva;
+
+
+static double medir_colectiva(Colectiva tipo, double* envio, double* recepcion,
+                              int elementos, MPI_Comm comunicador) {
+   int rango, tamano;
+   MPI_Comm_rank(comunicador, &rango);
+   MPI_Comm_size(comunicador, &tamano);
+
+   // Para Scatterv/Gatherv, elementos es el volumen total repartido
+   int* cuentas = (int*)reservar_o_abortar(tamano * sizeof(int), rango);
+   int* desplazamientos = (int*)reservar_o_abortar(tamano * sizeof(int), rango);
+   int offset = 0;
+   for (int i = 0; i < tamano; i++) {
+       cuentas[i] = elementos / tamano + (i < elementos % tamano ? 1 : 0);
+       desplazamientos[i] = offset;
+       offset += cuentas[i];
+   }
+
+   MPI_Barrier(comunicador);
+   double inicio = MPI_Wtime();
+   for (int r = 0; r < REPETICIONES_COLECTIVAS; r++) {
+       switch (tipo) {
+           case COLECTIVA_BCAST:
+               MPI_Bcast(envio, elementos, MPI_DOUBLE, 0, comunicador);
+               break;
+           case COLECTIVA_SCATTERV:
+               MPI_Scatterv(envio, cuentas, desplazamientos, MPI_DOUBLE,
+                            recepcion, cuentas[rango], MPI_DOUBLE, 0, comunicador);
+               break;
+           case COLECTIVA_GATHERV:
+               MPI_Gatherv(envio, cuentas[rango], MPI_DOUBLE,
+                           recepcion, cuentas, desplazamientos, MPI_DOUBLE, 0, comunicador);
+               break;
+           case COLECTIVA_REDUCE:
+               MPI_Reduce(envio, recepcion, elementos, MPI_DOUBLE, MPI_SUM, 0, comunicador);
+               break;
+       }
+   }
+   MPI_Barrier(comunicador);
+   double t = (MPI_Wtime() - inicio) / REPETICIONES_COLECTIVAS;
+
+   free(cuentas);
+   free(desplazamientos);
+   return t;
+}
+
+
+/**
+ * Mide el coste colectivo de crear y liberar una ventana RMA expuesta solo
+ * por la raíz, como hace multiplicar_matrices_mpi_rma. No depende del
+ * volumen transferido, así que ni alfa ni beta lo recogen.
+ */
+static void medir_ventana(ModeloCostos* modelo, int rango, int tamano) {
+   modelo->ventana = 0.0;
+   if (tamano < 2) return;
+
+   double dato = 0.0;
+   MPI_Barrier(MPI_COMM_WORLD);
+   double inicio = MPI_Wtime();
+   for (int r = 0; r < REPETICIONES_VENTANA; r++) {
+       MPI_Win ventana;
+       MPI_Win_create(rango == 0 ? &dato : NULL, rango == 0 ? (MPI_Aint)sizeof(double) : 0,
+                      sizeof(double), MPI_INFO_NULL, MPI_COMM_WORLD, &ventana);
+       MPI_Win_free(&ventana);
+   }
+   double t = (MPI_Wtime() - inicio) / REPETICIONES_VENTANA;
+
+   MPI_Allreduce(&t, &modelo->ventana, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+   if (rango == 0) {
+       printf("\n=== VENTANAS RMA ===\n");
+       printf("Crear + liberar una ventana: %.2f us\n", modelo->ventana * 1e6);
+   }
+}
+
+
+/**
+ * Barre MPI_Bcast, MPI_Scatterv, MPI_Gatherv y MPI_Reduce con subcomunicadores
+ * de 2, 4, 8, ... procesos (y el total) y mensajes de tamaño creciente,
+ * mostrando junto a cada medición la predicción del modelo.
+ */
+static void barrer_colectivas(const ModeloCostos* modelo, int rango, int tamano) {
+   static const char* nombres[] = {"Bcast", "Scatterv", "Gatherv", "Reduce"};
+   int elementos_maximos = BYTES_MAXIMOS / (int)sizeof(double);
+
+   double* envio = (double*)reservar_o_abortar(BYTES_MAXIMOS, rango);
+   double* recepcion = (double*)reservar_o_abortar(BYTES_MAXIMOS, rango);
+   for (int i = 0; i < elementos_maximos; i++) envio[i] = 1.0;
+
+   if (rango == 0) {
+       printf("\n=== BARRIDO DE COLECTIVAS ===\n");
+       printf("%-10s %9s %12s %14s %14s\n", "Operación", "Procesos", "Bytes", "Medido (us)", "Modelo (us)");
+   }
+
+   for (int procesos = 2; ; procesos *= 2) {
+       if (procesos > tamano) procesos = tamano;
+
+       MPI_Comm sub;
+       MPI_Comm_split(MPI_COMM_WORLD, rango < procesos ? 0 : MPI_UNDEFINED, rango, &sub);
+
+       for (int tipo = COLECTIVA_BCAST; tipo <= COLECTIVA_REDUCE; tipo++) {
+           for (int bytes = 1024; bytes <= BYTES_MAXIMOS; bytes *= 16) {
+               int elementos = bytes / (int)sizeof(double);
+               double t = 0.0;
+               if (sub != MPI_COMM_NULL) {
+                   t = medir_colectiva((Colectiva)tipo, envio, recepcion, elementos, sub);
+               }
+
+               if (rango == 0) {
+                   double prediccion = 0.0;
+                   switch ((Colectiva)tipo) {
+                       case COLECTIVA_BCAST:    prediccion = predecir_bcast(modelo, bytes, procesos); break;
+                       case COLECTIVA_SCATTERV: prediccion = predecir_scatterv(modelo, bytes, procesos); break;
+                       case COLECTIVA_GATHERV:  prediccion = predecir_gatherv(modelo, bytes, procesos); break;
+                       case COLECTIVA_REDUCE:   prediccion = predecir_reduce(modelo, bytes, procesos); break;
+                   }
+                   printf("%-10s %9d %12d %14.2f %14.2f\n", nombres[tipo], procesos, bytes,
+                          t * 1e6, prediccion * 1e6);
+               }
+           }
+       }
+
+       if (sub != MPI_COMM_NULL) MPI_Comm_free(&sub);
+       if (procesos >= tamano) break;
+   }
+
+   free(envio);
+   free(recepcion);
+}
+
+
+// ============================================================================
+// CÓMPUTO - Ancho de banda de memoria (tipo STREAM) y rendimiento del kernel
+// ============================================================================
+
+/**
+ * Triad de STREAM: a[i] = b[i] + s * c[i], 24 bytes movidos por elemento.
+ * Se mide en cada proceso a la vez y se informa el mínimo entre procesos.
+ */
+static void medir_stream(ModeloCostos* modelo, int rango) {
+   size_t bytes = (size_t)ELEMENTOS_STREAM * sizeof(double);
+   double* a = (double*)reservar_o_abortar(bytes, rango);
+   double* b = (double*)reservar_o_abortar(bytes, rango);
+   double* c = (double*)reservar_o_abortar(bytes, rango);
+   for (int i = 0; i < ELEMENTOS_STREAM; i++) {
+       a[i] = 0.0;
+       b[i] = 1.0;
+       c[i] = 2.0;
+   }
+
+   double mejor = 1e30;
+   for (int r = 0; r < REPETICIONES_STREAM; r++) {
+       MPI_Barrier(MPI_COMM_WORLD);
+       double inicio = MPI_Wtime();
+       for (int i = 0; i < ELEMENTOS_STREAM; i++) {
+           a[i] = b[i] + 3.0 * c[i];
+       }
+       double t = MPI_Wtime() - inicio;
+       if (t < mejor) mejor = t;
+   }
+
+   double ancho_banda = 3.0 * bytes / mejor;
+   double ancho_banda_min;
+   MPI_Allreduce(&ancho_banda, &ancho_banda_min, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+   modelo->ancho_banda_mem = ancho_banda_min;
+
+   if (rango == 0) {
+       printf("\n=== MEMORIA (STREAM triad) ===\n");
+       printf("Ancho de banda por proceso: %.2f GB/s (comprobación a[0] = %.1f)\n",
+              ancho_banda_min / 1e9, a[0]);
+   }
+
+   free(a);
+   free(b);
+   free(c);
+}
+
+
+/**
+ * Mide los GFLOP/s del kernel triple bucle del repositorio
+ * (multiplicar_bloque_filas, vía multiplicar_matrices_secuencial) en cada
+ * proceso y toma el más lento, que es el que marca el ritmo de un cálculo
+ * repartido. Es el rendimiento de ese kernel, no el pico de la máquina.
+ */
+static void medir_kernel(ModeloCostos* modelo, int rango) {
+   int n = TAMANIO_KERNEL;
+   double* A = crear_matriz(n);
+   double* B = crear_matriz(n);
+   double* C = crear_matriz(n);
+   if (!A || !B || !C) {
+       fprintf(stderr, "Proceso %d: Error en asignación de memoria\n", rango);
+       MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+   }
+   llenar_matriz(A, n);
+   llenar_matriz(B, n);
+
+   MPI_Barrier(MPI_COMM_WORLD);
+   double inicio = MPI_Wtime();
+   multiplicar_matrices_secuencial(A, B, C, n);
+   double t = MPI_Wtime() - inicio;
+
+   double t_max;
+   MPI_Allreduce(&t, &t_max, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+   double flops = 2.0 * n * n * (double)n;
+   modelo->gamma = t_max / flops;
+
+   if (rango == 0) {
+       printf("\n=== CÓMPUTO (kernel del repositorio %dx%d, no pico de la máquina) ===\n", n, n);
+       printf("Kernel triple bucle: %.3f GFLOP/s, gamma = %.4f ns/flop (suma C = %.3e)\n",
+              flops / t_max / 1e9, modelo->gamma * 1e9, calcular_suma_matriz(C, n));
+   }
+
+   liberar_matriz(A);
+   liberar_matriz(B);
+   liberar_matriz(C);
+}
+
+
+// ============================================================================
+// MODELO - Predicción frente a medición por estrategia
+// ============================================================================
+
+
+static void comparar_modelo_estrategias(const ModeloCostos* modelo, const int* tamanios,
+                                        int num_tamanios, int rango, int tamano) {
+   static void (*const funciones[NUM_ESTRATEGIAS])(const double*, const double*, double*, int) = {
+       multiplicar_matrices_mpi_scatter,
+       multiplicar_matrices_mpi_broadcast,
+       multiplicar_matrices_mpi_rma,
+       multiplicar_matrices_mpi_anillo
+   };
+
+   if (rango == 0) {
+       printf("\n=== MODELO ALFA-BETA-GAMMA: PREDICCIÓN VS MEDICIÓN (p = %d) ===\n", tamano);
+       printf("%6s %-10s %12s %12s %12s %12s %8s\n",
+              "n", "Estrategia", "Cómputo(s)", "Comunic.(s)", "Predicho(s)", "Medido(s)", "Error");
+   }
+
+   for (int t = 0; t < num_tamanios; t++) {
+       int n = tamanios[t];
+       double* A = NULL;
+       double* B = NULL;
+       double* C = NULL;
+
+       if (rango == 0) {
+           A = crear_matriz(n);
+           B = crear_matriz(n);
+           C = crear_matriz(n);
+           if (!A || !B || !C) {
+               fprintf(stderr, "Error: No se pudieron crear matrices de %dx%d\n", n, n);
+               MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+           }
+           llenar_matriz(A, n);
+           llenar_matriz(B, n);
+       }
+
+       for (int e = 0; e < NUM_ESTRATEGIAS; e++) {
+           MPI_Barrier(MPI_COMM_WORLD);
+           double inicio = MPI_Wtime();
+           funciones[e](A, B, C, n);
+           MPI_Barrier(MPI_COMM_WORLD);
+           double medido = MPI_Wtime() - inicio;
+
+           if (rango == 0) {
+               double computo = predecir_computo(modelo, n, tamano);
+               double comunicacion = predecir_comunicacion(modelo, (EstrategiaMPI)e, n, tamano);
+               double predicho = predecir_estrategia(modelo, (EstrategiaMPI)e, n, tamano);
+               printf("%6d %-10s %12.6f %12.6f %12.6f %12.6f %7.1f%%%s\n",
+                      n, nombre_estrategia((EstrategiaMPI)e), computo, comunicacion,
+                      predicho, medido, medido > 0.0 ? 100.0 * (predicho - medido) / medido : 0.0,
+                      e == ESTRATEGIA_ANILLO ? " *" : "");
+           }
+       }
+
+       if (rango == 0) {
+           liberar_matriz(A);
+           liberar_matriz(B);
+           liberar_matriz(C);
+       }
+   }
+
+   if (rango == 0 && tamano > 1) {
+       printf("* Anillo: Comunic. sin solape; Predicho con max(cómputo, desplazamiento) por paso.\n"
+              "  Desviación conocida: su bucle local (i-k-j) no es el kernel con el que se mide\n"
+              "  gamma, y el solape real depende de que MPI progrese en segundo plano.\n");
+   }
+}
+
+
+// ============================================================================
+// PROGRAMA PRINCIPAL
+// ============================================================================
+
+/**
+ * Uso: mpirun -np P ./benchmark_red [n1 n2 ...]
+ *
+ * Caracteriza la red (ping-pong y colectivas), la memoria y el kernel local,
+ * ajusta el modelo alfa-beta-gamma y compara sus predicciones con el tiempo
+ * medido de cada estrategia para los tamaños indicados (por defecto 128 y 256).
+ */
+int main(int argc, char* argv[]) {
+   int rango = 0;
+   int tamano = 1;
+
+   MPI_Init(&argc, &argv);
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+   MPI_Comm_size(MPI_COMM_WORLD, &tamano);
+
+   int tamanios_defecto[] = {128, 256};
+   int num_tamanios = (argc > 1) ? argc - 1 : (int)(sizeof(tamanios_defecto) / sizeof(tamanios_defecto[0]));
+   int* tamanios = (int*)reservar_o_abortar(num_tamanios * sizeof(int), rango);
+
+   for (int i = 0; i < num_tamanios; i++) {
+       if (argc > 1) {
+           char* fin_analisis;
+           tamanios[i] = (int)strtol(argv[i + 1], &fin_analisis, 10);
+           if (fin_analisis == argv[i + 1] || *fin_analisis != '\0' || tamanios[i] <= 0) {
+               if (rango == 0) {
+                   fprintf(stderr, "Error: Tamaño de matriz inválido '%s'\n", argv[i + 1]);
+               }
+               MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+           }
+       } else {
+           tamanios[i] = tamanios_defecto[i];
+       }
+   }
+
+   if (rango == 0) {
+       printf("\n=== CARACTERIZACIÓN DE RED Y CÓMPUTO - %d procesos ===\n", tamano);
+   }
+
+   ModeloCostos modelo = {0.0, 0.0, 0.0, 0.0, 0.0};
+   medir_ping_pong(&modelo, rango, tamano);
+   medir_ventana(&modelo, rango, tamano);
+   medir_stream(&modelo, rango);
+   medir_kernel(&modelo, rango);
+   if (tamano > 1) {
+       barrer_colectivas(&modelo, rango, tamano);
+   }
+   comparar_modelo_estrategias(&modelo, tamanios, num_tamanios, rango, tamano);
+
+   free(tamanios);
+   MPI_Finalize();
+   return EXIT_SUCCESS;
+}
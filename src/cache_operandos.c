@@ -0,0 +1,360 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mpi_simulado.h"
+#include "matrix_ops.h"
+#include "mpi_ops.h"
+#include "mpi_grande.h"
+#include "cache_operandos.h"
+
+
+#define MULTIPLICACIONES_PRUEBA 4
+
+
+// ============================================================================
+// ESTADO RESIDENTE (idéntico en todos los procesos)
+// ============================================================================
+
+
+static struct {
+   double* B;              // Copia local de B
+   int n;
+   uint64_t huella;        // Huella de B o etiqueta de versión del llamador
+   bool por_version;       // huella es una etiqueta de versión
+   bool valida;
+} residente = {NULL, 0, 0, false, false};
+
+static EstadisticasCache estadisticas = {0, 0, 0.0};
+
+
+// ============================================================================
+// HUELLA
+// ============================================================================
+
+/**
+ * Mezclador de 64 bits de splitmix64: biyectivo y con avalancha completa,
+ * así que cambiar cualquier bit de la entrada (también el de signo) cambia
+ * en promedio la mitad de los bits de la salida.
+ */
+static uint64_t mezclar_64(uint64_t x) {
+   x ^= x >> 30;
+   x *= 0xbf58476d1ce4e5b9ULL;
+   x ^= x >> 27;
+   x *= 0x94d049bb133111ebULL;
+   x ^= x >> 31;
+   return x;
+}
+
+
+/**
+ * Huella de 64 bits de B: cada elemento (su patrón de bits) se combina con
+ * el estado y el resultado pasa por mezclar_64, de modo que los cambios no
+ * se cancelan entre elementos. Cuesta una lectura de B en el raíz, muy por
+ * debajo de difundirla.
+ *
+ * La detección es probabilística: dos B distintas colisionan con
+ * probabilidad ~2^-64, y entonces se usaría la B residente obsoleta. Quien
+ * necesite certeza, o ya sepa cuándo cambia B, debe usar
+ * multiplicar_matrices_mpi_residente_version.
+ */
+uint64_t calcular_huella_matriz(const double* matriz, int n) {
+   uint64_t huella = mezclar_64((uint64_t)n);
+   if (!matriz) return huella;
+
+   size_t elementos = (size_t)n * n;
+   for (size_t i = 0; i < elementos; i++) {
+       uint64_t bits;
+       memcpy(&bits, &matriz[i], sizeof(bits));
+       huella = mezclar_64(huella ^ bits);
+   }
+   return huella;
+}
+
+
+// ============================================================================
+// GESTIÓN DEL OPERANDO RESIDENTE
+// ============================================================================
+
+/**
+ * Garantiza que B está residente en todos los procesos. El raíz difunde
+ * {n, etiqueta, por_version}, donde la etiqueta es la versión dada por el
+ * llamador (si version no es NULL) o la huella de B. Si coincide con la
+ * residente no se mueve nada más, y si no (o si forzar es true) se
+ * difunde B. Devuelve true si hubo acierto.
+ */
+static bool asegurar_residente(const double* B, int n, bool forzar, const uint64_t* version) {
+   int rango;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+
+   uint64_t cabecera[3] = {0, 0, 0};
+   if (rango == 0) {
+       cabecera[0] = (uint64_t)n;
+       cabecera[1] = version ? *version : calcular_huella_matriz(B, n);
+       cabecera[2] = version ? 1 : 0;
+   }
+   MPI_Bcast(cabecera, 3, MPI_UINT64_T, 0, MPI_COMM_WORLD);
+
+   size_t elementos = (size_t)n * n;
+   bool por_version = (cabecera[2] != 0);
+   bool acierto = !forzar && residente.valida && residente.por_version == por_version
+               && residente.n == (int)cabecera[0] && residente.huella == cabecera[1];
+
+   if (acierto) {
+       estadisticas.aciertos++;
+       estadisticas.bytes_evitados += (double)elementos * sizeof(double);
+       return true;
+   }
+
+   if (!residente.valida || residente.n != n) {
+       free(residente.B);
+       residente.B = (double*)malloc(elementos * sizeof(double));
+       if (!residente.B) {
+           fprintf(stderr, "Proceso %d: Error en asignación de memoria\n", rango);
+           MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+           return false;
+       }
+   }
+
+   if (rango == 0) {
+       memcpy(residente.B, B, elementos * sizeof(double));
+   }
+   bcast_grande(residente.B, elementos, 0);
+
+   residente.n = n;
+   residente.huella = cabecera[1];
+   residente.por_version = por_version;
+   residente.valida = true;
+   estadisticas.fallos++;
+   return false;
+}
+
+
+/**
+ * Registra B como operando residente de forma explícita (colectiva). Las
+ * llamadas posteriores a multiplicar_matrices_mpi_residente con la misma B
+ * solo mueven A y C.
+ */
+void registrar_operando_residente(const double* B, int n) {
+   asegurar_residente(B, n, true, NULL);
+}
+
+
+/**
+ * Libera la B residente en todos los procesos.
+ */
+void liberar_operando_residente(void) {
+   free(residente.B);
+   residente.B = NULL;
+   residente.n = 0;
+   residente.huella = 0;
+   residente.por_version = false;
+   residente.valida = false;
+}
+
+
+EstadisticasCache obtener_estadisticas_cache(void) {
+   return estadisticas;
+}
+
+
+// ============================================================================
+// MULTIPLICACIÓN CON B RESIDENTE
+// ============================================================================
+
+/**
+ * Reparte A, multiplica contra la B residente y recoge C en el raíz.
+ */
+static void multiplicar_contra_residente(const double* A, double* C, int n) {
+   int rango, tamano;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+   MPI_Comm_size(MPI_COMM_WORLD, &tamano);
+
+
+   // Distribución por filas de A y C
+   int filas_base = n / tamano;
+   int filas_extra = n % tamano;
+   int filas_local = filas_base + (rango < filas_extra ? 1 : 0);
+   size_t elementos_local = (size_t)filas_local * n;
+
+   int* filas_proceso = (int*)malloc(tamano * sizeof(int));
+   int* desplazamientos = (int*)malloc(tamano * sizeof(int));
+   double* A_local = (double*)malloc((elementos_local > 0 ? elementos_local : 1) * sizeof(double));
+   double* C_local = (double*)malloc((elementos_local > 0 ? elementos_local : 1) * sizeof(double));
+
+   if (!filas_proceso || !desplazamientos || !A_local || !C_local) {
+       fprintf(stderr, "Proceso %d: Error en asignación de memoria\n", rango);
+       MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+       return;
+   }
+
+   int offset = 0;
+   for (int i = 0; i < tamano; i++) {
+       filas_proceso[i] = filas_base + (i < filas_extra ? 1 : 0);
+       desplazamientos[i] = offset;
+       offset += filas_proceso[i];
+   }
+
+
+   scatterv_filas(A, filas_proceso, desplazamientos, A_local, n, 0);
+
+
+   multiplicar_bloque_filas(A_local, residente.B, C_local, (size_t)filas_local, (size_t)n, (size_t)n);
+
+
+   gatherv_filas(C_local, C, filas_proceso, desplazamientos, n, 0);
+
+
+   free(A_local);
+   free(C_local);
+   free(filas_proceso);
+   free(desplazamientos);
+}
+
+
+/**
+ * Igual que multiplicar_matrices_mpi_scatter, pero B solo se difunde si no
+ * está ya residente: en régimen estacionario se mueven únicamente las filas
+ * de A (MPI_Scatterv) y de C (MPI_Gatherv). El raíz recorre B una vez por
+ * llamada para calcular su huella.
+ *
+ * Parámetros:
+ *  A : Matriz A completa (solo relevante en el proceso raíz).
+ *  B : Matriz B completa (solo relevante en el proceso raíz).
+ *  C : Matriz de salida, ensamblada únicamente en el proceso raíz.
+ *  n : Dimensión de las matrices cuadradas (n x n).
+ */
+void multiplicar_matrices_mpi_residente(const double* A, const double* B, double* C, int n) {
+   asegurar_residente(B, n, false, NULL);
+   multiplicar_contra_residente(A, C, n);
+}
+
+
+/**
+ * Como multiplicar_matrices_mpi_residente, pero la identidad de B la da el
+ * llamador con una etiqueta de versión que debe cambiar cada vez que
+ * modifique B. No se calcula la huella, así que el coste por llamada no
+ * depende de n² en el raíz. version solo es relevante en el proceso raíz.
+ */
+void multiplicar_matrices_mpi_residente_version(const double* A, const double* B, double* C, int n,
+                                               uint64_t version) {
+   asegurar_residente(B, n, false, &version);
+   multiplicar_contra_residente(A, C, n);
+}
+
+
+// ============================================================================
+// PRUEBAS
+// ============================================================================
+
+/**
+ * Multiplica una misma B por varias A distintas comparando la estrategia
+ * Scatter (que difunde B siempre) con la de B residente, y después modifica
+ * B para comprobar que la huella detecta el cambio. Todos los procesos deben
+ * llamar a esta función; solo el raíz crea los datos y verifica.
+ */
+bool comparar_residente_mpi(int n) {
+   int rango;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+
+   double* A = NULL;
+   double* B = NULL;
+   double* C_secuencial = NULL;
+   double* C_mpi = NULL;
+   bool correcto = true;
+
+   if (rango == 0) {
+       printf("\n=== OPERANDO B RESIDENTE - Matriz %dx%d ===\n", n, n);
+       A = crear_matriz(n);
+       B = crear_matriz(n);
+       C_secuencial = crear_matriz(n);
+       C_mpi = crear_matriz(n);
+       if (!A || !B || !C_secuencial || !C_mpi) {
+           fprintf(stderr, "Error: No se pudieron crear matrices para prueba\n");
+           MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+       }
+       llenar_matriz(B, n);
+       printf("%-10s %14s %14s %10s\n", "Llamada", "Scatter (s)", "Residente (s)", "B");
+   }
+
+   for (int llamada = 0; llamada <= MULTIPLICACIONES_PRUEBA; llamada++) {
+       // La última llamada usa una B modificada: debe detectarse y re-difundirse
+       bool b_modificada = (llamada == MULTIPLICACIONES_PRUEBA);
+       long fallos_previos = obtener_estadisticas_cache().fallos;
+
+       if (rango == 0) {
+           llenar_matriz(A, n);
+           if (b_modificada) B[0] += 1.0;
+           multiplicar_matrices_secuencial(A, B, C_secuencial, n);
+       }
+
+       MPI_Barrier(MPI_COMM_WORLD);
+       double inicio = MPI_Wtime();
+       multiplicar_matrices_mpi_scatter(A, B, C_mpi, n);
+       MPI_Barrier(MPI_COMM_WORLD);
+       double tiempo_scatter = MPI_Wtime() - inicio;
+
+       MPI_Barrier(MPI_COMM_WORLD);
+       inicio = MPI_Wtime();
+       multiplicar_matrices_mpi_residente(A, B, C_mpi, n);
+       MPI_Barrier(MPI_COMM_WORLD);
+       double tiempo_residente = MPI_Wtime() - inicio;
+
+       bool hubo_fallo = obtener_estadisticas_cache().fallos > fallos_previos;
+
+       if (rango == 0) {
+           bool llamada_correcta = verificar_correccion_matriz(C_secuencial, C_mpi, n, TOLERANCIA_VERIFICACION);
+           // Solo deben fallar la primera llamada y la de B modificada
+           bool fallo_esperado = (llamada == 0 || b_modificada);
+           llamada_correcta = llamada_correcta && (hubo_fallo == fallo_esperado);
+           correcto = correcto && llamada_correcta;
+
+           printf("%-10d %14.6f %14.6f %10s %s\n", llamada + 1, tiempo_scatter, tiempo_residente,
+                  hubo_fallo ? "difundida" : "residente", llamada_correcta ? "✓" : "✗");
+       }
+   }
+
+   // Con etiqueta de versión no hay huella: la primera llamada cambia de
+   // modo (fallo), la segunda reutiliza B y la tercera trae una versión nueva
+   for (int llamada = 0; llamada < 3; llamada++) {
+       uint64_t version = (llamada < 2) ? 1 : 2;
+       long fallos_previos = obtener_estadisticas_cache().fallos;
+
+       if (rango == 0) {
+           llenar_matriz(A, n);
+           if (llamada == 2) B[0] += 1.0;
+           multiplicar_matrices_secuencial(A, B, C_secuencial, n);
+       }
+
+       MPI_Barrier(MPI_COMM_WORLD);
+       double inicio = MPI_Wtime();
+       multiplicar_matrices_mpi_residente_version(A, B, C_mpi, n, version);
+       MPI_Barrier(MPI_COMM_WORLD);
+       double tiempo_version = MPI_Wtime() - inicio;
+
+       bool hubo_fallo = obtener_estadisticas_cache().fallos > fallos_previos;
+
+       if (rango == 0) {
+           bool llamada_correcta = verificar_correccion_matriz(C_secuencial, C_mpi, n, TOLERANCIA_VERIFICACION);
+           bool fallo_esperado = (llamada != 1);
+           llamada_correcta = llamada_correcta && (hubo_fallo == fallo_esperado);
+           correcto = correcto && llamada_correcta;
+
+           printf("versión %-2llu %14s %14.6f %10s %s\n", (unsigned long long)version, "-", tiempo_version,
+                  hubo_fallo ? "difundida" : "residente", llamada_correcta ? "✓" : "✗");
+       }
+   }
+
+   if (rango == 0) {
+       EstadisticasCache e = obtener_estadisticas_cache();
+       printf("Aciertos: %ld, fallos: %ld, bytes de B no difundidos: %.0f\n",
+              e.aciertos, e.fallos, e.bytes_evitados);
+
+       liberar_matriz(A);
+       liberar_matriz(B);
+       liberar_matriz(C_secuencial);
+       liberar_matriz(C_mpi);
+   }
+
+   liberar_operando_residente();
+   return correcto;
+}
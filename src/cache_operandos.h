@@ -0,0 +1,50 @@
+#ifndef CACHE_OPERANDOS_H
+#define CACHE_OPERANDOS_H
+
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+// ============================================================================
+// OPERANDO B RESIDENTE - Evita re-difundir una B que no cambia
+// ============================================================================
+
+/*
+ * Cuando B es fija (matriz de pesos u operador) y se multiplica por una
+ * secuencia de matrices A distintas, B se difunde una sola vez y queda
+ * residente en todos los procesos tal como la usa el kernel local
+ * (multiplicar_bloque_filas no empaqueta B). En cada llamada el raíz
+ * calcula una huella de B y solo se difunde esa huella; B viaja de nuevo
+ * únicamente si la huella cambia. Si el llamador ya lleva la cuenta de las
+ * versiones de B, puede pasar una etiqueta de versión y evitar la huella.
+ * La huella detecta cambios de forma probabilística (colisión ~2^-64); la
+ * etiqueta de versión es la vía exacta.
+ */
+
+typedef struct {
+   long aciertos;          // Llamadas que reutilizaron la B residente
+   long fallos;            // Llamadas que tuvieron que difundir B
+   double bytes_evitados;  // Bytes de B que no se difundieron
+} EstadisticasCache;
+
+
+uint64_t calcular_huella_matriz(const double* matriz, int n);
+
+void registrar_operando_residente(const double* B, int n);
+void liberar_operando_residente(void);
+void multiplicar_matrices_mpi_residente(const double* A, const double* B, double* C, int n);
+void multiplicar_matrices_mpi_residente_version(const double* A, const double* B, double* C, int n,
+                                               uint64_t version);
+EstadisticasCache obtener_estadisticas_cache(void);
+
+
+// ============================================================================
+// PRUEBAS
+// ============================================================================
+
+
+bool comparar_residente_mpi(int n);
+
+
+#endif
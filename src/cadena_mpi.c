@@ -0,0 +1,495 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mpi_simulado.h"
+#include "matrix_ops.h"
+#include "mpi_grande.h"
+#include "cadena_mpi.h"
+
+
+
+// ============================================================================
+// UTILIDADES INTERNAS
+// ============================================================================
+
+
+static double* reservar_buffer(size_t elementos, int rango) {
+   // Siempre al menos un elemento para que los procesos sin filas tengan un puntero válido
+   double* buffer = (double*)malloc((elementos > 0 ? elementos : 1) * sizeof(double));
+   if (!buffer) {
+       fprintf(stderr, "Proceso %d: Error en asignación de memoria\n", rango);
+       MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+   }
+   return buffer;
+}
+
+
+/**
+ * Calcula la distribución por filas (striping) de una matriz de filas filas
+ * entre tamano procesos, en número de filas, tal como la esperan
+ * scatterv_filas, gatherv_filas y allgatherv_filas.
+ */
+static void calcular_distribucion(int filas, int tamano, int* cuentas, int* desplazamientos) {
+   int filas_base = filas / tamano;
+   int filas_extra = filas % tamano;
+   int offset = 0;
+
+   for (int i = 0; i < tamano; i++) {
+       cuentas[i] = filas_base + (i < filas_extra ? 1 : 0);
+       desplazamientos[i] = offset;
+       offset += cuentas[i];
+   }
+}
+
+
+// ============================================================================
+// ORDEN ÓPTIMO DE LA CADENA - Programación dinámica
+// ============================================================================
+
+/**
+ * Calcula la parentización óptima de la cadena minimizando el número de
+ * multiplicaciones escalares.
+ *
+ * divisiones debe tener num_matrices * num_matrices enteros; al terminar,
+ * divisiones[i * num_matrices + j] contiene el índice s tal que el producto
+ * M_i..M_j se evalúa como (M_i..M_s)(M_s+1..M_j).
+ */
+void calcular_orden_cadena(const int* dims, int num_matrices, int* divisiones) {
+   int m = num_matrices;
+   double* costo = (double*)calloc((size_t)m * m, sizeof(double));
+   if (!costo) {
+       fprintf(stderr, "Error: No se pudo reservar la tabla de costos de la cadena\n");
+       exit(EXIT_FAILURE);
+   }
+
+   for (int i = 0; i < m; i++) divisiones[i * m + i] = i;
+
+   for (int longitud = 2; longitud <= m; longitud++) {
+       for (int i = 0; i + longitud - 1 < m; i++) {
+           int j = i + longitud - 1;
+           costo[i * m + j] = -1.0;
+           for (int s = i; s < j; s++) {
+               double c = costo[i * m + s] + costo[(s + 1) * m + j]
+                        + (double)dims[i] * dims[s + 1] * dims[j + 1];
+               if (costo[i * m + j] < 0.0 || c < costo[i * m + j]) {
+                   costo[i * m + j] = c;
+                   divisiones[i * m + j] = s;
+               }
+           }
+       }
+   }
+
+   free(costo);
+}
+
+
+static double costo_subcadena(const int* dims, int m, const int* divisiones, int i, int j) {
+   if (i == j) return 0.0;
+   int s = divisiones[i * m + j];
+   return costo_subcadena(dims, m, divisiones, i, s)
+        + costo_subcadena(dims, m, divisiones, s + 1, j)
+        + (double)dims[i] * dims[s + 1] * dims[j + 1];
+}
+
+
+/**
+ * Devuelve el número de multiplicaciones escalares que implica evaluar la
+ * cadena con la parentización dada por divisiones.
+ */
+double costo_orden_cadena(const int* dims, int num_matrices, const int* divisiones) {
+   return costo_subcadena(dims, num_matrices, divisiones, 0, num_matrices - 1);
+}
+
+
+// ============================================================================
+// VERSIÓN SECUENCIAL (referencia)
+// ============================================================================
+
+
+static double* evaluar_subcadena_secuencial(const double* const* matrices, const int* dims, int m,
+                                            const int* divisiones, int i, int j) {
+   double* resultado = (double*)malloc((size_t)dims[i] * dims[j + 1] * sizeof(double));
+   if (!resultado) return NULL;
+
+   if (i == j) {
+       memcpy(resultado, matrices[i], (size_t)dims[i] * dims[i + 1] * sizeof(double));
+       return resultado;
+   }
+
+   int s = divisiones[i * m + j];
+   double* izquierda = evaluar_subcadena_secuencial(matrices, dims, m, divisiones, i, s);
+   double* derecha = evaluar_subcadena_secuencial(matrices, dims, m, divisiones, s + 1, j);
+   if (izquierda && derecha) {
+       multiplicar_bloque_filas(izquierda, derecha, resultado, dims[i], dims[s + 1], dims[j + 1]);
+   }
+   free(izquierda);
+   free(derecha);
+   return resultado;
+}
+
+
+/**
+ * Evalúa la cadena secuencialmente siguiendo la misma parentización óptima
+ * que la versión MPI, de modo que ambas sumen en el mismo orden.
+ */
+void multiplicar_cadena_secuencial(const double* const* matrices, const int* dims,
+                                   int num_matrices, double* C) {
+   if (!matrices || !C || num_matrices <= 0) return;
+
+   int* divisiones = (int*)malloc((size_t)num_matrices * num_matrices * sizeof(int));
+   if (!divisiones) return;
+   calcular_orden_cadena(dims, num_matrices, divisiones);
+
+   double* resultado = evaluar_subcadena_secuencial(matrices, dims, num_matrices, divisiones,
+                                                    0, num_matrices - 1);
+   if (resultado) {
+       memcpy(C, resultado, (size_t)dims[0] * dims[num_matrices] * sizeof(double));
+       free(resultado);
+   }
+   free(divisiones);
+}
+
+
+/**
+ * Calcula A^k por elevación al cuadrado repetida: k = 0 produce la identidad.
+ */
+void potencia_matriz_secuencial(const double* A, double* C, int n, int k) {
+   if (!A || !C || k < 0) return;
+
+   size_t bytes = (size_t)n * n * sizeof(double);
+   if (k == 0) {
+       memset(C, 0, bytes);
+       for (size_t i = 0; i < (size_t)n; i++) C[i * n + i] = 1.0;
+       return;
+   }
+
+   double* X = (double*)malloc(bytes);
+   double* temp = (double*)malloc(bytes);
+   if (!X || !temp) {
+       free(X);
+       free(temp);
+       return;
+   }
+   memcpy(X, A, bytes);
+
+   bool resultado_iniciado = false;
+   while (k > 0) {
+       if (k & 1) {
+           if (resultado_iniciado) {
+               multiplicar_bloque_filas(C, X, temp, n, n, n);
+               memcpy(C, temp, bytes);
+           } else {
+               memcpy(C, X, bytes);
+               resultado_iniciado = true;
+           }
+       }
+       k >>= 1;
+       if (k > 0) {
+           multiplicar_bloque_filas(X, X, temp, n, n, n);
+           memcpy(X, temp, bytes);
+       }
+   }
+
+   free(X);
+   free(temp);
+}
+
+
+// ============================================================================
+// VERSIÓN MPI - Intermedios distribuidos por filas
+// ============================================================================
+
+/*
+ * Cada subproducto M_i..M_j se mantiene distribuido por filas entre todos
+ * los procesos. Para multiplicar (izquierda)(derecha) cada proceso necesita
+ * sus filas de la izquierda y la derecha completa: si la derecha es una hoja
+ * se difunde desde el raíz con MPI_Bcast, y si es un intermedio se replica
+ * entre los procesos con MPI_Allgatherv sin pasar por el raíz. El resultado
+ * conserva la distribución por filas de la izquierda, que es justo la que
+ * necesita el siguiente paso. Solo hay un MPI_Gatherv al final.
+ */
+
+typedef struct {
+   const double* const* matrices;
+   const int* dims;
+   const int* divisiones;
+   int num_matrices;
+   int rango;
+   int tamano;
+   int* cuentas;
+   int* desplazamientos;
+} ContextoCadena;
+
+
+static double* evaluar_subcadena_distribuida(ContextoCadena* ctx, int i, int j);
+
+
+/**
+ * Devuelve la matriz M_i..M_j completa y replicada en todos los procesos.
+ */
+static double* obtener_operando_completo(ContextoCadena* ctx, int i, int j) {
+   int filas = ctx->dims[i];
+   int columnas = ctx->dims[j + 1];
+   size_t elementos = (size_t)filas * columnas;
+   double* completo = reservar_buffer(elementos, ctx->rango);
+
+   if (i == j) {
+       // Hoja: difusión directa desde el raíz, sin scatter previo
+       if (ctx->rango == 0) {
+           memcpy(completo, ctx->matrices[i], elementos * sizeof(double));
+       }
+       bcast_grande(completo, elementos, 0);
+       return completo;
+   }
+
+   double* local = evaluar_subcadena_distribuida(ctx, i, j);
+   calcular_distribucion(filas, ctx->tamano, ctx->cuentas, ctx->desplazamientos);
+   allgatherv_filas(local, completo, ctx->cuentas, ctx->desplazamientos, columnas);
+   free(local);
+   return completo;
+}
+
+
+/**
+ * Devuelve las filas locales de M_i..M_j según la distribución por filas.
+ */
+static double* evaluar_subcadena_distribuida(ContextoCadena* ctx, int i, int j) {
+   int filas = ctx->dims[i];
+   int columnas = ctx->dims[j + 1];
+
+   calcular_distribucion(filas, ctx->tamano, ctx->cuentas, ctx->desplazamientos);
+   int filas_local = ctx->cuentas[ctx->rango];
+   double* local = reservar_buffer((size_t)filas_local * columnas, ctx->rango);
+
+   if (i == j) {
+       scatterv_filas(ctx->rango == 0 ? ctx->matrices[i] : NULL,
+                      ctx->cuentas, ctx->desplazamientos, local, columnas, 0);
+       return local;
+   }
+
+   int s = ctx->divisiones[i * ctx->num_matrices + j];
+   double* izquierda = evaluar_subcadena_distribuida(ctx, i, s);
+   double* derecha = obtener_operando_completo(ctx, s + 1, j);
+
+   multiplicar_bloque_filas(izquierda, derecha, local, filas_local, ctx->dims[s + 1], columnas);
+
+   free(izquierda);
+   free(derecha);
+   return local;
+}
+
+
+/**
+ * Multiplica la cadena M_0 · M_1 · ... · M_{num_matrices-1} con la
+ * parentización óptima, manteniendo todos los intermedios distribuidos.
+ *
+ * Parámetros:
+ *  matrices     : Punteros a las matrices de la cadena (solo en el raíz).
+ *  dims         : num_matrices + 1 dimensiones (en todos los procesos).
+ *  num_matrices : Longitud de la cadena.
+ *  C            : Resultado dims[0] x dims[num_matrices], solo en el raíz.
+ */
+void multiplicar_cadena_mpi(const double* const* matrices, const int* dims,
+                            int num_matrices, double* C) {
+   int rango, tamano;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+   MPI_Comm_size(MPI_COMM_WORLD, &tamano);
+
+   if (num_matrices <= 0) return;
+
+   int* divisiones = (int*)malloc((size_t)num_matrices * num_matrices * sizeof(int));
+   int* cuentas = (int*)malloc(tamano * sizeof(int));
+   int* desplazamientos = (int*)malloc(tamano * sizeof(int));
+   if (!divisiones || !cuentas || !desplazamientos) {
+       fprintf(stderr, "Proceso %d: Error en asignación de memoria\n", rango);
+       MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+       return;
+   }
+
+   // Todos los procesos calculan el mismo orden a partir de las mismas formas
+   calcular_orden_cadena(dims, num_matrices, divisiones);
+
+   ContextoCadena ctx = {
+       .matrices = matrices,
+       .dims = dims,
+       .divisiones = divisiones,
+       .num_matrices = num_matrices,
+       .rango = rango,
+       .tamano = tamano,
+       .cuentas = cuentas,
+       .desplazamientos = desplazamientos
+   };
+
+   double* C_local = evaluar_subcadena_distribuida(&ctx, 0, num_matrices - 1);
+
+   // Única recolección en el raíz
+   calcular_distribucion(dims[0], tamano, cuentas, desplazamientos);
+   gatherv_filas(C_local, C, cuentas, desplazamientos, dims[num_matrices], 0);
+
+   free(C_local);
+   free(divisiones);
+   free(cuentas);
+   free(desplazamientos);
+}
+
+
+/**
+ * Calcula A^k por elevación al cuadrado repetida.
+ *
+ * A se difunde una sola vez; a partir de ahí cada cuadrado X·X se calcula
+ * por filas y se replica con MPI_Allgatherv entre los procesos, y el
+ * acumulador R permanece distribuido por filas hasta el MPI_Gatherv final.
+ */
+void potencia_matriz_mpi(const double* A, double* C, int n, int k) {
+   int rango, tamano;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+   MPI_Comm_size(MPI_COMM_WORLD, &tamano);
+
+   if (k < 0) return;
+   if (k == 0) {
+       if (rango == 0) potencia_matriz_secuencial(A, C, n, 0);
+       return;
+   }
+
+   int* cuentas = (int*)malloc(tamano * sizeof(int));
+   int* desplazamientos = (int*)malloc(tamano * sizeof(int));
+   if (!cuentas || !desplazamientos) {
+       fprintf(stderr, "Proceso %d: Error en asignación de memoria\n", rango);
+       MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+       return;
+   }
+   calcular_distribucion(n, tamano, cuentas, desplazamientos);
+
+   int filas_local = cuentas[rango];
+   size_t elementos_local = (size_t)filas_local * n;
+   size_t elementos_matriz = (size_t)n * n;
+
+   double* X_completa = reservar_buffer(elementos_matriz, rango);
+   double* X_nueva = reservar_buffer(elementos_local, rango);
+   double* R_local = reservar_buffer(elementos_local, rango);
+   double* temp = reservar_buffer(elementos_local, rango);
+
+   if (rango == 0) {
+       memcpy(X_completa, A, elementos_matriz * sizeof(double));
+   }
+   bcast_grande(X_completa, elementos_matriz, 0);
+
+   bool resultado_iniciado = false;
+   while (k > 0) {
+       // Las filas locales de X están dentro de la copia completa
+       const double* X_local = X_completa + (size_t)desplazamientos[rango] * n;
+
+       if (k & 1) {
+           if (resultado_iniciado) {
+               multiplicar_bloque_filas(R_local, X_completa, temp, filas_local, n, n);
+               double* aux = R_local;
+               R_local = temp;
+               temp = aux;
+           } else {
+               memcpy(R_local, X_local, elementos_local * sizeof(double));
+               resultado_iniciado = true;
+           }
+       }
+       k >>= 1;
+       if (k > 0) {
+           multiplicar_bloque_filas(X_local, X_completa, X_nueva, filas_local, n, n);
+           allgatherv_filas(X_nueva, X_completa, cuentas, desplazamientos, n);
+       }
+   }
+
+   gatherv_filas(R_local, C, cuentas, desplazamientos, n, 0);
+
+   free(X_completa);
+   free(X_nueva);
+   free(R_local);
+   free(temp);
+   free(cuentas);
+   free(desplazamientos);
+}
+
+
+// ============================================================================
+// PRUEBAS
+// ============================================================================
+
+/**
+ * Compara las versiones secuencial y MPI de una cadena de cuatro matrices
+ * rectangulares y de A^5. Todos los procesos deben llamar a esta función;
+ * solo el raíz crea los datos y verifica.
+ */
+bool comparar_cadena_mpi(int n) {
+   int rango;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+
+   enum { NUM_CADENA = 4, EXPONENTE = 5 };
+   const int dims[NUM_CADENA + 1] = {n, n / 4 + 1, n, n / 2 + 1, n};
+
+   double* matrices[NUM_CADENA] = {NULL};
+   double* A = NULL;
+   double* C_secuencial = NULL;
+   double* C_mpi = NULL;
+   bool correcto = true;
+
+   if (rango == 0) {
+       printf("\n=== PRODUCTO EN CADENA Y POTENCIAS MPI - n = %d ===\n", n);
+
+       for (int i = 0; i < NUM_CADENA; i++) {
+           matrices[i] = (double*)malloc((size_t)dims[i] * dims[i + 1] * sizeof(double));
+           if (!matrices[i]) {
+               fprintf(stderr, "Error: No se pudieron crear matrices para la cadena\n");
+               MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+           }
+           for (size_t e = 0; e < (size_t)dims[i] * dims[i + 1]; e++) {
+               matrices[i][e] = (double)rand() / RAND_MAX;
+           }
+       }
+       A = crear_matriz(n);
+       C_secuencial = crear_matriz(n);
+       C_mpi = crear_matriz(n);
+       for (size_t e = 0; e < (size_t)n * n; e++) A[e] = (double)rand() / RAND_MAX;
+
+       int divisiones[NUM_CADENA * NUM_CADENA];
+       int izquierda_a_derecha[NUM_CADENA * NUM_CADENA];
+       calcular_orden_cadena(dims, NUM_CADENA, divisiones);
+       for (int i = 0; i < NUM_CADENA; i++) {
+           for (int j = i; j < NUM_CADENA; j++) izquierda_a_derecha[i * NUM_CADENA + j] = (i == j) ? i : j - 1;
+       }
+       printf("Multiplicaciones escalares - óptimo: %.0f, izquierda a derecha: %.0f\n",
+              costo_orden_cadena(dims, NUM_CADENA, divisiones),
+              costo_orden_cadena(dims, NUM_CADENA, izquierda_a_derecha));
+
+       multiplicar_cadena_secuencial((const double* const*)matrices, dims, NUM_CADENA, C_secuencial);
+   }
+
+   MPI_Barrier(MPI_COMM_WORLD);
+   double inicio = MPI_Wtime();
+   multiplicar_cadena_mpi((const double* const*)matrices, dims, NUM_CADENA, C_mpi);
+   MPI_Barrier(MPI_COMM_WORLD);
+   double tiempo_cadena = MPI_Wtime() - inicio;
+
+   if (rango == 0) {
+       bool cadena_correcta = verificar_correccion_matriz(C_secuencial, C_mpi, n, TOLERANCIA_VERIFICACION);
+       printf("Cadena MPI:    %.6f segundos %s\n", tiempo_cadena, cadena_correcta ? "✓" : "✗");
+       correcto = correcto && cadena_correcta;
+       potencia_matriz_secuencial(A, C_secuencial, n, EXPONENTE);
+   }
+
+   MPI_Barrier(MPI_COMM_WORLD);
+   inicio = MPI_Wtime();
+   potencia_matriz_mpi(A, C_mpi, n, EXPONENTE);
+   MPI_Barrier(MPI_COMM_WORLD);
+   double tiempo_potencia = MPI_Wtime() - inicio;
+
+   if (rango == 0) {
+       bool potencia_correcta = verificar_correccion_matriz(C_secuencial, C_mpi, n, TOLERANCIA_VERIFICACION);
+       printf("Potencia A^%d: %.6f segundos %s\n", EXPONENTE, tiempo_potencia, potencia_correcta ? "✓" : "✗");
+       correcto = correcto && potencia_correcta;
+
+       for (int i = 0; i < NUM_CADENA; i++) free(matrices[i]);
+       liberar_matriz(A);
+       liberar_matriz(C_secuencial);
+       liberar_matriz(C_mpi);
+   }
+
+   return correcto;
+}
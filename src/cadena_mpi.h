@@ -0,0 +1,40 @@
+#ifndef CADENA_MPI_H
+#define CADENA_MPI_H
+
+
+#include <stdbool.h>
+
+
+// ============================================================================
+// PRODUCTO EN CADENA Y POTENCIAS CON INTERMEDIOS DISTRIBUIDOS
+// ============================================================================
+
+/*
+ * Convención de formas: la matriz i de la cadena tiene dims[i] filas y
+ * dims[i + 1] columnas, por lo que una cadena de num_matrices matrices
+ * requiere num_matrices + 1 dimensiones. dims y num_matrices deben ser
+ * conocidos por todos los procesos; los datos (matrices, A, C) solo son
+ * relevantes en el proceso raíz.
+ */
+
+void calcular_orden_cadena(const int* dims, int num_matrices, int* divisiones);
+double costo_orden_cadena(const int* dims, int num_matrices, const int* divisiones);
+
+void multiplicar_cadena_secuencial(const double* const* matrices, const int* dims,
+                                   int num_matrices, double* C);
+void multiplicar_cadena_mpi(const double* const* matrices, const int* dims,
+                            int num_matrices, double* C);
+
+void potencia_matriz_secuencial(const double* A, double* C, int n, int k);
+void potencia_matriz_mpi(const double* A, double* C, int n, int k);
+
+
+// ============================================================================
+// PRUEBAS
+// ============================================================================
+
+
+bool comparar_cadena_mpi(int n);
+
+
+#endif
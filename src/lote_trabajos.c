@@ -0,0 +1,545 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include "mpi_simulado.h"
+#include "matrix_ops.h"
+#include "mpi_grande.h"
+#include "lote_trabajos.h"
+
+
+
+// ============================================================================
+// RANURAS DEL PIPELINE
+// ============================================================================
+
+/*
+ * Cada ranura guarda los buffers de un trabajo: las filas locales de A,
+ * B completa y las filas locales de C. Con RANURAS_PIPELINE = 4 conviven
+ * la lectura del trabajo i+2, la difusión de B del i+1, el cómputo del i y
+ * la escritura del i-1. Los buffers se reutilizan entre trabajos y solo
+ * crecen.
+ *
+ * Los archivos se abren con MPI_COMM_SELF: abrir y cerrar no son
+ * colectivos, así que no sincronizan a los procesos entre trabajos. La
+ * única colectiva por trabajo es la difusión no bloqueante de B.
+ *
+ * MPI-IO devuelve los errores (MPI_ERRORS_RETURN) y una lectura más allá
+ * del final no falla: solo transfiere menos datos. Por eso se comprueban
+ * el código de cada llamada, el tamaño de los archivos frente a su
+ * cabecera y la cuenta transferida de cada lectura y escritura; cualquier
+ * fallo aborta el lote.
+ */
+typedef struct {
+   int n;
+   int filas_local;
+   int fila_inicio;
+   const char* ruta_A;
+   const char* ruta_B;
+   const char* ruta_C;
+
+   double* A_local;
+   double* B;
+   double* C_local;
+   size_t capacidad_A;
+   size_t capacidad_B;
+   size_t capacidad_C;
+
+   MPI_Datatype fila;
+   MPI_File archivo_A;
+   MPI_File archivo_B;        // Solo en el raíz, hasta que termina su lectura
+   MPI_File archivo_C;
+   bool archivo_C_abierto;
+   MPI_Request lecturas[2];   // Lectura de las filas de A y difusión de B
+   MPI_Request lectura_B;     // Lectura de B en el raíz
+   MPI_Request escritura;
+   bool escritura_pendiente;
+} RanuraTrabajo;
+
+
+static void abortar_lote(int rango, const char* mensaje, const char* ruta) {
+   fprintf(stderr, "Proceso %d: %s '%s'\n", rango, mensaje, ruta);
+   MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+}
+
+
+static void comprobar_es(int codigo, int rango, const char* mensaje, const char* ruta) {
+   if (codigo != MPI_SUCCESS) abortar_lote(rango, mensaje, ruta);
+}
+
+
+/**
+ * Aborta si la operación terminada en estado no transfirió exactamente
+ * esperados elementos de tipo (archivo truncado o disco lleno).
+ */
+static void comprobar_cuenta(const MPI_Status* estado, MPI_Datatype tipo, int esperados,
+                             int rango, const char* mensaje, const char* ruta) {
+   int cuenta = 0;
+   if (MPI_Get_count(estado, tipo, &cuenta) != MPI_SUCCESS || cuenta != esperados) {
+       abortar_lote(rango, mensaje, ruta);
+   }
+}
+
+
+static void asegurar_capacidad(double** buffer, size_t* capacidad, size_t elementos, int rango) {
+   if (elementos == 0) elementos = 1;
+   if (*capacidad >= elementos) return;
+
+   free(*buffer);
+   *buffer = (double*)malloc(elementos * sizeof(double));
+   if (!*buffer) {
+       fprintf(stderr, "Proceso %d: Error en asignación de memoria\n", rango);
+       MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+   }
+   *capacidad = elementos;
+}
+
+
+/**
+ * Lee la cabecera y comprueba que el archivo mide exactamente lo que
+ * declara (cabecera + n*n doubles).
+ */
+static int leer_dimension(MPI_File archivo, const char* ruta, int rango) {
+   char cabecera[BYTES_CABECERA_MATRIZ];
+   MPI_Status estado;
+   comprobar_es(MPI_File_read_at(archivo, 0, cabecera, BYTES_CABECERA_MATRIZ, MPI_BYTE, &estado),
+                rango, "Error al leer la cabecera de", ruta);
+   comprobar_cuenta(&estado, MPI_BYTE, BYTES_CABECERA_MATRIZ, rango, "Cabecera incompleta en", ruta);
+
+   int64_t n64;
+   memcpy(&n64, cabecera + 8, sizeof(n64));
+   if (memcmp(cabecera, FIRMA_MATRIZ_BINARIA, 8) != 0 || n64 <= 0 || n64 > INT_MAX) {
+       abortar_lote(rango, "Matriz binaria inválida", ruta);
+   }
+
+   MPI_Offset tamano_archivo = 0;
+   comprobar_es(MPI_File_get_size(archivo, &tamano_archivo), rango, "Error al consultar el tamaño de", ruta);
+   if (tamano_archivo != BYTES_CABECERA_MATRIZ + (MPI_Offset)n64 * n64 * (MPI_Offset)sizeof(double)) {
+       abortar_lote(rango, "Tamaño de archivo distinto del declarado en la cabecera", ruta);
+   }
+   return (int)n64;
+}
+
+
+static void abrir_archivo(const char* ruta, int modo, MPI_File* archivo, int rango) {
+   if (MPI_File_open(MPI_COMM_SELF, ruta, modo, MPI_INFO_NULL, archivo) != MPI_SUCCESS) {
+       abortar_lote(rango, (modo & MPI_MODE_CREATE) ? "No se pudo crear" : "No se pudo abrir", ruta);
+   }
+}
+
+
+// ============================================================================
+// ETAPAS: CARGA, DIFUSIÓN, CÓMPUTO Y ESCRITURA
+// ============================================================================
+
+/**
+ * Lanza la lectura de un trabajo. Cada proceso lee de A directamente su
+ * bloque de filas, y el raíz lee B completa; ambas lecturas son no
+ * bloqueantes. B se difunde en la etapa siguiente (iniciar_difusion), una
+ * vez leída, así que la latencia del disco no queda en el camino crítico.
+ *
+ * El raíz también crea ya C con su tamaño final y su cabecera: el resto de
+ * procesos solo escribe sus filas después de recibir B, así que nunca
+ * escribe antes de que C exista y esté truncada.
+ */
+static void iniciar_carga(RanuraTrabajo* r, const char* ruta_A, const char* ruta_B, const char* ruta_C,
+                          int rango, int tamano) {
+   r->ruta_A = ruta_A;
+   r->ruta_B = ruta_B;
+   r->ruta_C = ruta_C;
+
+   abrir_archivo(ruta_A, MPI_MODE_RDONLY, &r->archivo_A, rango);
+   int n = leer_dimension(r->archivo_A, ruta_A, rango);
+
+   int filas_base = n / tamano;
+   int filas_extra = n % tamano;
+   r->n = n;
+   r->filas_local = filas_base + (rango < filas_extra ? 1 : 0);
+   r->fila_inicio = rango * filas_base + (rango < filas_extra ? rango : filas_extra);
+
+   asegurar_capacidad(&r->A_local, &r->capacidad_A, (size_t)r->filas_local * n, rango);
+   asegurar_capacidad(&r->B, &r->capacidad_B, (size_t)n * n, rango);
+   asegurar_capacidad(&r->C_local, &r->capacidad_C, (size_t)r->filas_local * n, rango);
+
+   r->fila = crear_tipo_fila(n);
+   MPI_Offset inicio_A = BYTES_CABECERA_MATRIZ + (MPI_Offset)r->fila_inicio * n * sizeof(double);
+   comprobar_es(MPI_File_iread_at(r->archivo_A, inicio_A, r->A_local, r->filas_local, r->fila, &r->lecturas[0]),
+                rango, "Error al leer", ruta_A);
+
+   if (rango == 0) {
+       abrir_archivo(ruta_B, MPI_MODE_RDONLY, &r->archivo_B, rango);
+       if (leer_dimension(r->archivo_B, ruta_B, rango) != n) {
+           abortar_lote(rango, "Dimensión de B distinta de la de A en", ruta_B);
+       }
+       comprobar_es(MPI_File_iread_at(r->archivo_B, BYTES_CABECERA_MATRIZ, r->B, n, r->fila, &r->lectura_B),
+                    rango, "Error al leer", ruta_B);
+
+       abrir_archivo(ruta_C, MPI_MODE_CREATE | MPI_MODE_WRONLY, &r->archivo_C, rango);
+       comprobar_es(MPI_File_set_size(r->archivo_C, BYTES_CABECERA_MATRIZ + (MPI_Offset)n * n * sizeof(double)),
+                    rango, "No se pudo dimensionar", ruta_C);
+
+       char cabecera[BYTES_CABECERA_MATRIZ];
+       int64_t n64 = n;
+       memcpy(cabecera, FIRMA_MATRIZ_BINARIA, 8);
+       memcpy(cabecera + 8, &n64, sizeof(n64));
+       MPI_Status estado;
+       comprobar_es(MPI_File_write_at(r->archivo_C, 0, cabecera, BYTES_CABECERA_MATRIZ, MPI_BYTE, &estado),
+                    rango, "Error al escribir la cabecera de", ruta_C);
+       comprobar_cuenta(&estado, MPI_BYTE, BYTES_CABECERA_MATRIZ, rango, "Cabecera incompleta en", ruta_C);
+       r->archivo_C_abierto = true;
+   }
+}
+
+
+/**
+ * El raíz espera la lectura de B y todos los procesos inician su difusión
+ * no bloqueante, que avanza mientras se calcula el trabajo anterior.
+ */
+static void iniciar_difusion(RanuraTrabajo* r, int rango) {
+   if (rango == 0) {
+       MPI_Status estado;
+       comprobar_es(MPI_Wait(&r->lectura_B, &estado), rango, "Error al leer", r->ruta_B);
+       comprobar_cuenta(&estado, r->fila, r->n, rango, "Lectura incompleta de", r->ruta_B);
+       MPI_File_close(&r->archivo_B);
+   }
+   comprobar_es(MPI_Ibcast(r->B, r->n, r->fila, 0, MPI_COMM_WORLD, &r->lecturas[1]),
+                rango, "Error al difundir", r->ruta_B);
+}
+
+
+static void esperar_carga(RanuraTrabajo* r, int rango) {
+   MPI_Status estados[2];
+   comprobar_es(MPI_Waitall(2, r->lecturas, estados), rango, "Error al cargar el trabajo de", r->ruta_A);
+   comprobar_cuenta(&estados[0], r->fila, r->filas_local, rango, "Lectura incompleta de", r->ruta_A);
+   MPI_File_close(&r->archivo_A);
+}
+
+
+static void calcular_trabajo(RanuraTrabajo* r) {
+   multiplicar_bloque_filas(r->A_local, r->B, r->C_local, (size_t)r->filas_local, (size_t)r->n, (size_t)r->n);
+}
+
+
+/**
+ * Cada proceso lanza la escritura no bloqueante de sus filas en su
+ * posición de C (el raíz ya la abrió al cargar el trabajo).
+ */
+static void iniciar_escritura(RanuraTrabajo* r, int rango) {
+   if (!r->archivo_C_abierto) {
+       abrir_archivo(r->ruta_C, MPI_MODE_WRONLY, &r->archivo_C, rango);
+       r->archivo_C_abierto = true;
+   }
+
+   MPI_Offset inicio_C = BYTES_CABECERA_MATRIZ + (MPI_Offset)r->fila_inicio * r->n * sizeof(double);
+   comprobar_es(MPI_File_iwrite_at(r->archivo_C, inicio_C, r->C_local, r->filas_local, r->fila, &r->escritura),
+                rango, "Error al escribir", r->ruta_C);
+   r->escritura_pendiente = true;
+}
+
+
+static void esperar_escritura(RanuraTrabajo* r, int rango) {
+   if (!r->escritura_pendiente) return;
+   MPI_Status estado;
+   comprobar_es(MPI_Wait(&r->escritura, &estado), rango, "Error al escribir", r->ruta_C);
+   comprobar_cuenta(&estado, r->fila, r->filas_local, rango, "Escritura incompleta de", r->ruta_C);
+   comprobar_es(MPI_File_close(&r->archivo_C), rango, "Error al cerrar", r->ruta_C);
+   liberar_tipo_fila(&r->fila);
+   r->archivo_C_abierto = false;
+   r->escritura_pendiente = false;
+}
+
+
+// ============================================================================
+// MANIFIESTO
+// ============================================================================
+
+/**
+ * Separa una línea del manifiesto en sus tres rutas. Devuelve false si no
+ * hay exactamente tres o si alguna no cabe en LONGITUD_MAXIMA_RUTA bytes
+ * (nunca se truncan: una ruta truncada apuntaría a otro archivo).
+ */
+static bool separar_rutas(const char* linea, char* destino) {
+   const char* separadores = " \t\r\n";
+   const char* p = linea;
+   int campos = 0;
+
+   while (1) {
+       p += strspn(p, separadores);
+       if (*p == '\0') break;
+       size_t longitud = strcspn(p, separadores);
+       if (campos == 3 || longitud >= LONGITUD_MAXIMA_RUTA) return false;
+
+       char* ruta = destino + (size_t)campos * LONGITUD_MAXIMA_RUTA;
+       memcpy(ruta, p, longitud);
+       ruta[longitud] = '\0';
+       campos++;
+       p += longitud;
+   }
+   return campos == 3;
+}
+
+
+/**
+ * El raíz lee el manifiesto y difunde las rutas a todos los procesos como
+ * un arreglo plano de num_trabajos * 3 rutas de LONGITUD_MAXIMA_RUTA bytes.
+ * Devuelve el número de trabajos (-1 si hubo error).
+ */
+static int leer_manifiesto(const char* manifiesto, char** rutas, int rango) {
+   int num_trabajos = 0;
+   int capacidad = 0;
+   char* buffer = NULL;
+
+   if (rango == 0) {
+       FILE* archivo = fopen(manifiesto, "r");
+       if (!archivo) {
+           fprintf(stderr, "Error: No se pudo abrir el manifiesto '%s'\n", manifiesto);
+           num_trabajos = -1;
+       } else {
+           char linea[3 * LONGITUD_MAXIMA_RUTA + 16];
+           int numero_linea = 0;
+           while (num_trabajos >= 0 && fgets(linea, sizeof(linea), archivo)) {
+               numero_linea++;
+               char* inicio = linea + strspn(linea, " \t");
+               if (*inicio == '#' || *inicio == '\n' || *inicio == '\0') continue;
+
+               if (num_trabajos == capacidad) {
+                   capacidad = capacidad ? 2 * capacidad : 64;
+                   char* nuevo = (char*)realloc(buffer, (size_t)capacidad * 3 * LONGITUD_MAXIMA_RUTA);
+                   if (!nuevo) {
+                       fprintf(stderr, "Error: Manifiesto demasiado grande\n");
+                       MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+                   }
+                   buffer = nuevo;
+               }
+
+               // Una línea que no cabe en el buffer tiene alguna ruta demasiado larga
+               bool completa = strchr(linea, '\n') != NULL || feof(archivo);
+               char* destino = buffer + (size_t)num_trabajos * 3 * LONGITUD_MAXIMA_RUTA;
+               if (!completa || !separar_rutas(inicio, destino)) {
+                   fprintf(stderr, "Error: Línea %d del manifiesto '%s' inválida: se esperan tres rutas "
+                                   "de menos de %d bytes\n", numero_linea, manifiesto, LONGITUD_MAXIMA_RUTA);
+                   num_trabajos = -1;
+                   break;
+               }
+               num_trabajos++;
+           }
+           fclose(archivo);
+       }
+   }
+
+   MPI_Bcast(&num_trabajos, 1, MPI_INT, 0, MPI_COMM_WORLD);
+   if (num_trabajos <= 0) {
+       free(buffer);
+       *rutas = NULL;
+       return num_trabajos;
+   }
+
+   if (rango != 0) {
+       buffer = (char*)malloc((size_t)num_trabajos * 3 * LONGITUD_MAXIMA_RUTA);
+       if (!buffer) {
+           fprintf(stderr, "Proceso %d: Error en asignación de memoria\n", rango);
+           MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+       }
+   }
+
+   // Un trabajo (sus tres rutas) por elemento: el conteo es num_trabajos y
+   // no el número de bytes, que podría no caber en int
+   MPI_Datatype tipo_trabajo;
+   MPI_Type_contiguous(3 * LONGITUD_MAXIMA_RUTA, MPI_CHAR, &tipo_trabajo);
+   MPI_Type_commit(&tipo_trabajo);
+   MPI_Bcast(buffer, num_trabajos, tipo_trabajo, 0, MPI_COMM_WORLD);
+   MPI_Type_free(&tipo_trabajo);
+
+   *rutas = buffer;
+   return num_trabajos;
+}
+
+
+static const char* ruta_trabajo(const char* rutas, int trabajo, int indice) {
+   return rutas + ((size_t)trabajo * 3 + indice) * LONGITUD_MAXIMA_RUTA;
+}
+
+
+// ============================================================================
+// MOTOR POR LOTES
+// ============================================================================
+
+/**
+ * Ejecuta todos los trabajos del manifiesto en un pipeline: mientras se
+ * calcula el trabajo i, ya están en curso la lectura del i+2, la difusión
+ * de B del i+1 y la escritura del i-1. Informa trabajos/s y GFLOP/s; con verificar, el
+ * raíz recalcula cada producto secuencialmente y lo compara con C.
+ */
+bool ejecutar_lote(const char* manifiesto, bool verificar) {
+   int rango, tamano;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+   MPI_Comm_size(MPI_COMM_WORLD, &tamano);
+
+   char* rutas = NULL;
+   int num_trabajos = leer_manifiesto(manifiesto, &rutas, rango);
+   if (num_trabajos <= 0) {
+       if (rango == 0 && num_trabajos == 0) printf("Manifiesto sin trabajos: '%s'\n", manifiesto);
+       return num_trabajos == 0;
+   }
+
+   if (rango == 0) {
+       printf("\n=== MOTOR POR LOTES - %d trabajos, %d procesos ===\n", num_trabajos, tamano);
+   }
+
+   RanuraTrabajo ranuras[RANURAS_PIPELINE];
+   memset(ranuras, 0, sizeof(ranuras));
+   for (int r = 0; r < RANURAS_PIPELINE; r++) ranuras[r].fila = MPI_DATATYPE_NULL;
+
+   double flops_totales = 0.0;
+
+   MPI_Barrier(MPI_COMM_WORLD);
+   double inicio = MPI_Wtime();
+
+   // Prólogo: el trabajo 0 leído y en difusión, el 1 en lectura
+   for (int j = 0; j < 2 && j < num_trabajos; j++) {
+       iniciar_carga(&ranuras[j], ruta_trabajo(rutas, j, 0), ruta_trabajo(rutas, j, 1),
+                     ruta_trabajo(rutas, j, 2), rango, tamano);
+   }
+   iniciar_difusion(&ranuras[0], rango);
+
+   for (int i = 0; i < num_trabajos; i++) {
+       RanuraTrabajo* actual = &ranuras[i % RANURAS_PIPELINE];
+       esperar_carga(actual, rango);
+
+       // Etapa 1: difundir B del trabajo i+1 (ya leída) y leer el i+2, cuya
+       // ranura quedó libre al terminar la escritura del i-2
+       if (i + 1 < num_trabajos) {
+           iniciar_difusion(&ranuras[(i + 1) % RANURAS_PIPELINE], rango);
+       }
+       if (i + 2 < num_trabajos) {
+           iniciar_carga(&ranuras[(i + 2) % RANURAS_PIPELINE],
+                         ruta_trabajo(rutas, i + 2, 0), ruta_trabajo(rutas, i + 2, 1),
+                         ruta_trabajo(rutas, i + 2, 2), rango, tamano);
+       }
+
+       // Etapa 2: calcular el trabajo actual
+       calcular_trabajo(actual);
+       flops_totales += 2.0 * actual->n * actual->n * (double)actual->n;
+
+       // Etapa 3: terminar la escritura anterior y lanzar la del trabajo actual
+       if (i > 0) {
+           esperar_escritura(&ranuras[(i - 1) % RANURAS_PIPELINE], rango);
+       }
+       iniciar_escritura(actual, rango);
+   }
+   esperar_escritura(&ranuras[(num_trabajos - 1) % RANURAS_PIPELINE], rango);
+
+   MPI_Barrier(MPI_COMM_WORLD);
+   double tiempo = MPI_Wtime() - inicio;
+
+   for (int r = 0; r < RANURAS_PIPELINE; r++) {
+       free(ranuras[r].A_local);
+       free(ranuras[r].B);
+       free(ranuras[r].C_local);
+   }
+
+   bool correcto = true;
+   if (rango == 0) {
+       printf("Tiempo total: %.6f segundos\n", tiempo);
+       printf("Rendimiento: %.2f trabajos/s, %.3f GFLOP/s\n",
+              num_trabajos / tiempo, flops_totales / tiempo / 1e9);
+
+       if (verificar) {
+           int verificados = 0;
+           for (int i = 0; i < num_trabajos; i++) {
+               int n_A = 0, n_B = 0, n_C = 0;
+               double* A = cargar_matriz_binaria(ruta_trabajo(rutas, i, 0), &n_A);
+               double* B = cargar_matriz_binaria(ruta_trabajo(rutas, i, 1), &n_B);
+               double* C = cargar_matriz_binaria(ruta_trabajo(rutas, i, 2), &n_C);
+               double* C_secuencial = (A && n_A == n_B && n_A == n_C) ? crear_matriz(n_A) : NULL;
+
+               bool trabajo_correcto = false;
+               if (C_secuencial && B && C) {
+                   multiplicar_matrices_secuencial(A, B, C_secuencial, n_A);
+                   trabajo_correcto = verificar_correccion_matriz(C_secuencial, C, n_A, TOLERANCIA_VERIFICACION);
+               }
+               if (trabajo_correcto) verificados++;
+               else printf("Trabajo %d (%s): ✗\n", i, ruta_trabajo(rutas, i, 2));
+
+               liberar_matriz(A);
+               liberar_matriz(B);
+               liberar_matriz(C);
+               liberar_matriz(C_secuencial);
+           }
+           correcto = (verificados == num_trabajos);
+           printf("Verificación: %d/%d trabajos %s\n", verificados, num_trabajos, correcto ? "✓" : "✗");
+       }
+   }
+
+   free(rutas);
+   MPI_Bcast(&correcto, 1, MPI_C_BOOL, 0, MPI_COMM_WORLD);
+   return correcto;
+}
+
+
+/**
+ * Crea en directorio num_trabajos pares A_i, B_i aleatorios de n x n y un
+ * manifiesto.txt que escribe cada C_i en el mismo directorio. Solo el raíz
+ * escribe; el resto espera en la barrera final.
+ */
+bool generar_lote_prueba(const char* directorio, int num_trabajos, int n) {
+   int rango;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+
+   bool correcto = true;
+   if (rango == 0) {
+       if (mkdir(directorio, 0755) != 0 && errno != EEXIST) {
+           fprintf(stderr, "Error: No se pudo crear el directorio '%s'\n", directorio);
+           correcto = false;
+       }
+
+       char ruta_manifiesto[LONGITUD_MAXIMA_RUTA];
+       int longitud = snprintf(ruta_manifiesto, sizeof(ruta_manifiesto), "%s/manifiesto.txt", directorio);
+       if (correcto && (longitud < 0 || (size_t)longitud >= sizeof(ruta_manifiesto))) {
+           fprintf(stderr, "Error: Directorio demasiado largo '%s'\n", directorio);
+           correcto = false;
+       }
+       FILE* manifiesto = correcto ? fopen(ruta_manifiesto, "w") : NULL;
+       if (correcto && !manifiesto) {
+           fprintf(stderr, "Error: No se pudo crear '%s'\n", ruta_manifiesto);
+           correcto = false;
+       }
+
+       double* matriz = correcto ? crear_matriz(n) : NULL;
+       if (correcto && !matriz) {
+           fprintf(stderr, "Error: Falló la asignación de memoria\n");
+           correcto = false;
+       }
+       for (int i = 0; correcto && i < num_trabajos; i++) {
+           char ruta_A[LONGITUD_MAXIMA_RUTA], ruta_B[LONGITUD_MAXIMA_RUTA], ruta_C[LONGITUD_MAXIMA_RUTA];
+           // Las tres rutas tienen la misma longitud: basta comprobar una
+           int longitud_C = snprintf(ruta_C, sizeof(ruta_C), "%s/C_%d.bin", directorio, i);
+           if (longitud_C < 0 || (size_t)longitud_C >= sizeof(ruta_C)) {
+               fprintf(stderr, "Error: Directorio demasiado largo '%s'\n", directorio);
+               correcto = false;
+               break;
+           }
+           snprintf(ruta_A, sizeof(ruta_A), "%s/A_%d.bin", directorio, i);
+           snprintf(ruta_B, sizeof(ruta_B), "%s/B_%d.bin", directorio, i);
+
+           llenar_matriz(matriz, n);
+           correcto = guardar_matriz_binaria(ruta_A, matriz, n);
+           llenar_matriz(matriz, n);
+           correcto = correcto && guardar_matriz_binaria(ruta_B, matriz, n);
+           fprintf(manifiesto, "%s %s %s\n", ruta_A, ruta_B, ruta_C);
+       }
+       liberar_matriz(matriz);
+
+       if (manifiesto) fclose(manifiesto);
+       if (correcto) {
+           printf("Lote de prueba: %d trabajos de %dx%d en '%s'\n", num_trabajos, n, n, ruta_manifiesto);
+       }
+   }
+
+   MPI_Bcast(&correcto, 1, MPI_C_BOOL, 0, MPI_COMM_WORLD);
+   return correcto;
+}
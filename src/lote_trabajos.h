@@ -0,0 +1,41 @@
+#ifndef LOTE_TRABAJOS_H
+#define LOTE_TRABAJOS_H
+
+
+#include <stdbool.h>
+
+
+// ============================================================================
+// CONFIGURACIÓN
+// ============================================================================
+#define LONGITUD_MAXIMA_RUTA 512
+#define RANURAS_PIPELINE 4
+
+
+// ============================================================================
+// MOTOR POR LOTES - Pipeline carga / cómputo / escritura
+// ============================================================================
+
+/*
+ * El manifiesto es un archivo de texto con un trabajo por línea:
+ *
+ *     ruta_A ruta_B ruta_C
+ *
+ * (rutas sin espacios y de menos de LONGITUD_MAXIMA_RUTA bytes; una línea
+ * mal formada invalida el manifiesto; las líneas vacías o que empiezan con
+ * '#' se ignoran). A y B se leen y C se escribe en el formato binario de
+ * matrix_ops.h; cada trabajo debe escribir una C distinta.
+ *
+ * Un archivo que no se puede abrir, cuyo tamaño no coincide con su
+ * cabecera, o una lectura o escritura incompleta abortan el lote
+ * (MPI_Abort) con un mensaje que nombra el archivo.
+ *
+ * Todos los procesos deben llamar a estas funciones; solo el raíz lee el
+ * manifiesto e imprime resultados.
+ */
+
+bool ejecutar_lote(const char* manifiesto, bool verificar);
+bool generar_lote_prueba(const char* directorio, int num_trabajos, int n);
+
+
+#endif
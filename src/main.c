@@ -3,53 +3,21 @@
 #include <string.h>
 #include <time.h>
 #include <stdbool.h>
+#include <limits.h>
 #include "matrix_ops.h"
 #include "mpi_ops.h"
+#include "cadena_mpi.h"
+#include "cache_operandos.h"
+#include "lote_trabajos.h"
+#include "transporte_reducido.h"
+#include "producto_simetrico.h"
+#include "motor_hilos.h"
+#include "mpi_simulado.h"
 
 
 #define TAMANIO_POR_DEFECTO 4
-#define TOLERANCIA_VERIFICACION 1e-9
 
 
-#ifdef __linux__
-#define TIENE_MPI_REAL 1
-#include <mpi.h>
-#else
-#define TIENE_MPI_REAL 0
-typedef int Comunicador_MPI;
-#define MUNDO_MPI 0
-#define EXITO_MPI 0
-
-
-static inline double Tiempo_MPI(void) { return (double)clock() / CLOCKS_PER_SEC; }
-static inline int Inicializar_MPI(void) { return EXITO_MPI; }
-static inline int Obtener_Rango_MPI(int* rango) {
-   *rango = 0;
-   return EXITO_MPI;
-}
-static inline int Obtener_Tamano_MPI(int* tamano) {
-   *tamano = 1;
-   return EXITO_MPI;
-}
-static inline int Barrera_MPI(void) { return EXITO_MPI; }
-static inline int Abortar_MPI(int codigo_error) {
-   exit(codigo_error);
-   return EXITO_MPI;
-}
-static inline int Finalizar_MPI(void) { return EXITO_MPI; }
-
-
-#define MPI_Init(argc, argv) Inicializar_MPI()
-#define MPI_Comm_rank(comm, rank) Obtener_Rango_MPI(rank)
-#define MPI_Comm_size(comm, size) Obtener_Tamano_MPI(size)
-#define MPI_Barrier(comm) Barrera_MPI()
-#define MPI_Abort(comm, code) Abortar_MPI(code)
-#define MPI_Finalize() Finalizar_MPI()
-#define MPI_Wtime() Tiempo_MPI()
-#define MPI_COMM_WORLD MUNDO_MPI
-#define MPI_SUCCESS EXITO_MPI
-#endif
-
 /**
  * Imprime información básica del entorno de ejecución MPI,
  * como el número de procesos y si se está usando MPI real o simulado.
@@ -68,58 +36,190 @@ void mostrar_info_mpi(int rango, int tamano) {
 }
 
 /**
- * Valida y procesa el tamaño de matriz recibido por línea de comandos.
- * Solo el proceso raíz imprime errores para evitar duplicación de mensajes.
+ * Motor de cómputo de la demostración. MOTOR_HILOS añade el motor de
+ * pthreads (en el proceso raíz) a las estrategias MPI; sin MPI real es el
+ * valor por defecto, porque es el único paralelismo disponible.
+ */
+typedef enum {
+   MOTOR_MPI,
+   MOTOR_HILOS
+} MotorCalculo;
+
+
+/**
+ * Opciones de la demostración principal:
+ *   ./matrix_multiply [n] [--pruebas] [--transporte fp64|fp32|bf16|sin-perdida] [--motor mpi|hilos]
+ */
+typedef struct {
+   int n;
+   bool pruebas;                  // Ejecutar también las pruebas de los módulos avanzados
+   FormatoTransporte transporte;  // Formato en red de Scatter y Broadcast
+   MotorCalculo motor;
+} OpcionesDemo;
+
+
+void mostrar_uso(const char* programa) {
+   fprintf(stderr, "Uso: %s [n] [--pruebas] [--transporte fp64|fp32|bf16|sin-perdida] [--motor mpi|hilos] | "
+                   "--hilos [n] [max_hilos] | --lote manifiesto [--verificar] | "
+                   "--generar-lote dir num n\n", programa);
+}
+
+
+/**
+ * Valida y procesa el tamaño de matriz y las opciones recibidas por línea
+ * de comandos. Solo el proceso raíz imprime errores para evitar duplicación
+ * de mensajes.
  */
-int procesar_argumentos(int argc, char* argv[], int rango) {
-   int N = TAMANIO_POR_DEFECTO;
+bool procesar_argumentos(int argc, char* argv[], int rango, OpcionesDemo* opciones) {
+   long N = TAMANIO_POR_DEFECTO;
+   bool tamano_leido = false;
 
+   opciones->pruebas = false;
+   opciones->transporte = TRANSPORTE_FP64;
+   opciones->motor = TIENE_MPI_REAL ? MOTOR_MPI : MOTOR_HILOS;
+
+
+   for (int i = 1; i < argc; i++) {
+       if (strcmp(argv[i], "--pruebas") == 0) {
+           opciones->pruebas = true;
+           continue;
+       }
+       if (strcmp(argv[i], "--transporte") == 0) {
+           if (i + 1 >= argc || !analizar_formato_transporte(argv[i + 1], &opciones->transporte)) {
+               if (rango == 0) {
+                   fprintf(stderr, "Error: Formato de transporte inválido '%s' (fp64, fp32, bf16 o sin-perdida)\n",
+                           i + 1 < argc ? argv[i + 1] : "");
+               }
+               return false;
+           }
+           i++;
+           continue;
+       }
+       if (strcmp(argv[i], "--motor") == 0) {
+           if (i + 1 < argc && strcmp(argv[i + 1], "mpi") == 0) {
+               opciones->motor = MOTOR_MPI;
+           } else if (i + 1 < argc && strcmp(argv[i + 1], "hilos") == 0) {
+               opciones->motor = MOTOR_HILOS;
+           } else {
+               if (rango == 0) {
+                   fprintf(stderr, "Error: Motor inválido '%s' (mpi o hilos)\n", i + 1 < argc ? argv[i + 1] : "");
+               }
+               return false;
+           }
+           i++;
+           continue;
+       }
 
-   if (argc > 1) {
        char* fin_analisis;
-       N = strtol(argv[1], &fin_analisis, 10);
-       if (fin_analisis == argv[1] || *fin_analisis != '\0' || N <= 0) {
+       N = strtol(argv[i], &fin_analisis, 10);
+       // n cabe en int; los productos n*n se calculan en size_t
+       if (tamano_leido || fin_analisis == argv[i] || *fin_analisis != '\0' || N <= 0 || N > INT_MAX) {
            if (rango == 0) {
-               fprintf(stderr, "Error: Tamaño de matriz inválido '%s'\n", argv[1]);
+               if (strncmp(argv[i], "--", 2) == 0 || tamano_leido) {
+                   mostrar_uso(argv[0]);
+               } else {
+                   fprintf(stderr, "Error: Tamaño de matriz inválido '%s'\n", argv[i]);
+               }
            }
-           MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
-           return -1;
+           return false;
        }
+       tamano_leido = true;
    }
 
 
-   return N;
+   opciones->n = (int)N;
+   return true;
 }
 
 
-double medir_tiempo_mpi_wrapper(const double* A, const double* B, double* C, int n,
-                              void (*funcion_multiplicacion)(const double*, const double*, double*, int)) {
-   MPI_Barrier(MPI_COMM_WORLD);
-   double inicio = MPI_Wtime();
+/**
+ * Motor de hilos: ./matrix_multiply --hilos [n] [max_hilos]
+ * Se ejecuta en un solo proceso, antes de MPI_Init, así que no necesita
+ * mpirun. max_hilos = 0 (por defecto) usa un hilo por núcleo.
+ */
+int ejecutar_modo_hilos(int argc, char* argv[]) {
+   long N = TAMANIO_POR_DEFECTO;
+   long hilos = 0;
+   char* fin_analisis;
+
+   if (argc > 2) {
+       N = strtol(argv[2], &fin_analisis, 10);
+       if (fin_analisis == argv[2] || *fin_analisis != '\0' || N <= 0 || N > INT_MAX) {
+           fprintf(stderr, "Error: Tamaño de matriz inválido '%s'\n", argv[2]);
+           return EXIT_FAILURE;
+       }
+   }
+   if (argc > 3) {
+       hilos = strtol(argv[3], &fin_analisis, 10);
+       if (fin_analisis == argv[3] || *fin_analisis != '\0' || hilos < 0 || hilos > MAXIMO_HILOS) {
+           fprintf(stderr, "Error: Número de hilos inválido '%s'\n", argv[3]);
+           return EXIT_FAILURE;
+       }
+   }
 
+   return comparar_motor_hilos((int)N, (int)hilos) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
 
-   funcion_multiplicacion(A, B, C, n);
 
+/**
+ * Modos por lotes de la línea de comandos:
+ *   --lote manifiesto [--verificar]   ejecuta los trabajos del manifiesto
+ *   --generar-lote dir num n          crea un lote de prueba en dir
+ * Devuelve -1 si argv no pide un modo por lotes; si no, el código de salida.
+ */
+int procesar_modo_lote(int argc, char* argv[], int rango) {
+   if (argc < 2) return -1;
 
-   MPI_Barrier(MPI_COMM_WORLD);
-   return MPI_Wtime() - inicio;
+   if (strcmp(argv[1], "--lote") == 0 && argc >= 3) {
+       bool verificar = (argc >= 4 && strcmp(argv[3], "--verificar") == 0);
+       return ejecutar_lote(argv[2], verificar) ? EXIT_SUCCESS : EXIT_FAILURE;
+   }
+
+   if (strcmp(argv[1], "--generar-lote") == 0 && argc >= 5) {
+       char* fin_num;
+       char* fin_n;
+       long num = strtol(argv[3], &fin_num, 10);
+       long n = strtol(argv[4], &fin_n, 10);
+       if (fin_num == argv[3] || *fin_num != '\0' || num <= 0 || num > INT_MAX ||
+           fin_n == argv[4] || *fin_n != '\0' || n <= 0 || n > INT_MAX) {
+           if (rango == 0) {
+               fprintf(stderr, "Error: Lote inválido (%s trabajos de %s)\n", argv[3], argv[4]);
+           }
+           return EXIT_FAILURE;
+       }
+       return generar_lote_prueba(argv[2], (int)num, (int)n) ? EXIT_SUCCESS : EXIT_FAILURE;
+   }
+
+   return -1;
 }
 
+
 /**
  * Controla el flujo principal del experimento de multiplicación de matrices.
  *
  * Etapas:
  *   1. Inicialización y llenado de matrices (solo en rank 0)
- *   2. Ejecución secuencial (baseline)
+ *   2. Ejecución secuencial (baseline) y, con MOTOR_HILOS, motor de hilos
  *   3. Ejecución paralela con Scatter/Gather
  *   4. Ejecución paralela con Broadcast
- *   5. Validación de resultados
- *   6. Reporte de speedup
+ *   5. Ejecución paralela con RMA (comunicación unilateral)
+ *   6. Ejecución paralela con anillo sistólico 1D
+ *   7. Validación de resultados
+ *   8. Reporte de speedup
+ *
+ * Scatter y Broadcast mueven los datos en el formato de transporte dado;
+ * con fp32 o bf16 se verifican con error relativo (verificar_con_formato).
+ * Devuelve true si todas las verificaciones pasan (siempre true fuera del
+ * proceso raíz, que es el único que verifica).
  */
-void ejecutar_demo_paralela(int N, int rango, int tamano) {
+bool ejecutar_demo_paralela(int N, int rango, int tamano, FormatoTransporte transporte, MotorCalculo motor) {
+   bool correcto = true;
    double tiempo_secuencial = 0.0;
+   double tiempo_hilos = 0.0;
    double tiempo_scatter = 0.0;
    double tiempo_bcast = 0.0;
+   double tiempo_rma = 0.0;
+   double tiempo_anillo = 0.0;
 
 
    // 🟡 CORREGIDO: Declarar punteros aquí para todos los procesos
@@ -128,12 +228,15 @@ void ejecutar_demo_paralela(int N, int rango, int tamano) {
    double* C_secuencial = NULL;
    double* C_paralelo_scatter = NULL;
    double* C_paralelo_bcast = NULL;
+   double* C_paralelo_rma = NULL;
+   double* C_paralelo_anillo = NULL;
 
 
    if (rango == 0) {
        printf("\n=== MULTIPLICACIÓN PARALELA MPI - SEMANA 2 ===\n");
        printf("Tamaño de matriz: %dx%d\n", N, N);
        printf("Procesos MPI: %d\n", tamano);
+       printf("Transporte Scatter/Broadcast: %s\n", nombre_formato_transporte(transporte));
 
 
        A = crear_matriz(N);
@@ -141,12 +244,14 @@ void ejecutar_demo_paralela(int N, int rango, int tamano) {
        C_secuencial = crear_matriz(N);
        C_paralelo_scatter = crear_matriz(N);
        C_paralelo_bcast = crear_matriz(N);
+       C_paralelo_rma = crear_matriz(N);
+       C_paralelo_anillo = crear_matriz(N);
 
 
-       if (!A || !B || !C_secuencial || !C_paralelo_scatter || !C_paralelo_bcast) {
+       if (!A || !B || !C_secuencial || !C_paralelo_scatter || !C_paralelo_bcast || !C_paralelo_rma || !C_paralelo_anillo) {
            fprintf(stderr, "Error: Falló la asignación de memoria\n");
            MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
-           return;
+           return false;
        }
 
 
@@ -160,6 +265,29 @@ void ejecutar_demo_paralela(int N, int rango, int tamano) {
        multiplicar_matrices_secuencial(A, B, C_secuencial, N);
        tiempo_secuencial = MPI_Wtime() - tiempo_inicio;
        printf("Tiempo secuencial: %.6f segundos\n", tiempo_secuencial);
+
+
+       if (motor == MOTOR_HILOS) {
+           printf("\n🟢 EJECUTANDO MOTOR DE HILOS...\n");
+           double* C_hilos = crear_matriz(N);
+           if (!C_hilos || !iniciar_motor_hilos(0)) {
+               fprintf(stderr, "Error: No se pudo iniciar el motor de hilos\n");
+               MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+               return false;
+           }
+
+           tiempo_inicio = MPI_Wtime();
+           multiplicar_matrices_hilos(A, B, C_hilos, N);
+           tiempo_hilos = MPI_Wtime() - tiempo_inicio;
+           printf("Tiempo motor de hilos (%d hilos): %.6f segundos\n", obtener_hilos_motor(), tiempo_hilos);
+
+           bool hilos_correcto = verificar_correccion_matriz(C_secuencial, C_hilos, N, TOLERANCIA_VERIFICACION);
+           printf("Verificación Hilos: %s\n", hilos_correcto ? "✓ EXITOSA" : "✗ FALLIDA");
+           correcto = correcto && hilos_correcto;
+
+           detener_motor_hilos();
+           liberar_matriz(C_hilos);
+       }
    } else {
        // 🟡 CORREGIDO: Otros procesos NO crean matrices dummy
        // Las funciones MPI se encargarán de la memoria necesaria
@@ -167,6 +295,8 @@ void ejecutar_demo_paralela(int N, int rango, int tamano) {
        B = NULL;
        C_paralelo_scatter = NULL;
        C_paralelo_bcast = NULL;
+       C_paralelo_rma = NULL;
+       C_paralelo_anillo = NULL;
    }
 
 
@@ -181,15 +311,23 @@ void ejecutar_demo_paralela(int N, int rango, int tamano) {
 
    // Todos los procesos participan, pero solo el proceso 0 necesita el resultado
    double* C_scatter_temp = (rango == 0) ? C_paralelo_scatter : crear_matriz(1);
-   tiempo_scatter = medir_tiempo_mpi_wrapper(A, B, C_scatter_temp, N, multiplicar_matrices_mpi_scatter);
+   EstadisticasTransporte transporte_scatter = {0.0, 0.0};
+   tiempo_scatter = medir_tiempo_mpi_paralelo(A, B, C_scatter_temp, N, NULL,
+                                              multiplicar_matrices_mpi_scatter_formato,
+                                              transporte, &transporte_scatter);
 
 
    if (rango == 0) {
        printf("Tiempo MPI Scatter: %.6f segundos\n", tiempo_scatter);
+       if (transporte != TRANSPORTE_FP64) {
+           printf("Bytes en red: %.0f de %.0f en fp64\n",
+                  transporte_scatter.bytes_enviados, transporte_scatter.bytes_fp64);
+       }
 
 
-       bool scatter_correcto = verificar_correccion_matriz(C_secuencial, C_paralelo_scatter, N, TOLERANCIA_VERIFICACION);
+       bool scatter_correcto = verificar_con_formato(C_secuencial, C_paralelo_scatter, N, transporte, NULL);
        printf("Verificación Scatter: %s\n", scatter_correcto ? "✓ EXITOSA" : "✗ FALLIDA");
+       correcto = correcto && scatter_correcto;
    } else {
        liberar_matriz(C_scatter_temp); // 🟡 Liberar matriz temporal de otros procesos
    }
@@ -204,18 +342,83 @@ void ejecutar_demo_paralela(int N, int rango, int tamano) {
 
 
    double* C_bcast_temp = (rango == 0) ? C_paralelo_bcast : crear_matriz(1);
-   tiempo_bcast = medir_tiempo_mpi_wrapper(A, B, C_bcast_temp, N, multiplicar_matrices_mpi_broadcast);
+   EstadisticasTransporte transporte_bcast = {0.0, 0.0};
+   tiempo_bcast = medir_tiempo_mpi_paralelo(A, B, C_bcast_temp, N, NULL,
+                                            multiplicar_matrices_mpi_broadcast_formato,
+                                            transporte, &transporte_bcast);
 
 
    if (rango == 0) {
        printf("Tiempo MPI Broadcast: %.6f segundos\n", tiempo_bcast);
+       if (transporte != TRANSPORTE_FP64) {
+           printf("Bytes en red: %.0f de %.0f en fp64\n",
+                  transporte_bcast.bytes_enviados, transporte_bcast.bytes_fp64);
+       }
 
 
-       bool bcast_correcto = verificar_correccion_matriz(C_secuencial, C_paralelo_bcast, N, TOLERANCIA_VERIFICACION);
+       bool bcast_correcto = verificar_con_formato(C_secuencial, C_paralelo_bcast, N, transporte, NULL);
        printf("Verificación Broadcast: %s\n", bcast_correcto ? "✓ EXITOSA" : "✗ FALLIDA");
+       correcto = correcto && bcast_correcto;
+   } else {
+       liberar_matriz(C_bcast_temp); // 🟡 Liberar matriz temporal de otros procesos
+   }
+
+
+   MPI_Barrier(MPI_COMM_WORLD);
+
+
+   if (rango == 0) {
+       printf("\n🟡 EJECUTANDO MULTIPLICACIÓN MPI RMA...\n");
+   }
+
+
+   double* C_rma_temp = (rango == 0) ? C_paralelo_rma : crear_matriz(1);
+   tiempo_rma = medir_tiempo_mpi_paralelo(A, B, C_rma_temp, N, multiplicar_matrices_mpi_rma, NULL,
+                                          TRANSPORTE_FP64, NULL);
+
+
+   if (rango == 0) {
+       printf("Tiempo MPI RMA: %.6f segundos\n", tiempo_rma);
+
+
+       bool rma_correcto = verificar_correccion_matriz(C_secuencial, C_paralelo_rma, N, TOLERANCIA_VERIFICACION);
+       printf("Verificación RMA: %s\n", rma_correcto ? "✓ EXITOSA" : "✗ FALLIDA");
+       correcto = correcto && rma_correcto;
+   } else {
+       liberar_matriz(C_rma_temp); // 🟡 Liberar matriz temporal de otros procesos
+   }
+
+
+   MPI_Barrier(MPI_COMM_WORLD);
+
+
+   if (rango == 0) {
+       printf("\n🟡 EJECUTANDO MULTIPLICACIÓN MPI ANILLO...\n");
+   }
+
+
+   double* C_anillo_temp = (rango == 0) ? C_paralelo_anillo : crear_matriz(1);
+   tiempo_anillo = medir_tiempo_mpi_paralelo(A, B, C_anillo_temp, N, multiplicar_matrices_mpi_anillo, NULL,
+                                             TRANSPORTE_FP64, NULL);
+
+
+   if (rango == 0) {
+       printf("Tiempo MPI Anillo: %.6f segundos\n", tiempo_anillo);
+
+
+       // El anillo suma en otro orden: se compara con error relativo
+       double error_anillo = calcular_error_relativo(C_secuencial, C_paralelo_anillo, N);
+       bool anillo_correcto = error_anillo <= TOLERANCIA_RELATIVA_MPI;
+       printf("Verificación Anillo: %s (error relativo %.2e)\n",
+              anillo_correcto ? "✓ EXITOSA" : "✗ FALLIDA", error_anillo);
+       correcto = correcto && anillo_correcto;
 
 
        printf("\n=== ANÁLISIS DE RENDIMIENTO ===\n");
+       if (tiempo_hilos > 0 && tiempo_secuencial > 0) {
+           double speedup_hilos = tiempo_secuencial / tiempo_hilos;
+           printf("Speedup Hilos: %.2fx\n", speedup_hilos);
+       }
        if (tiempo_scatter > 0 && tiempo_secuencial > 0) {
            double speedup_scatter = tiempo_secuencial / tiempo_scatter;
            printf("Speedup Scatter: %.2fx\n", speedup_scatter);
@@ -224,6 +427,14 @@ void ejecutar_demo_paralela(int N, int rango, int tamano) {
            double speedup_bcast = tiempo_secuencial / tiempo_bcast;
            printf("Speedup Broadcast: %.2fx\n", speedup_bcast);
        }
+       if (tiempo_rma > 0 && tiempo_secuencial > 0) {
+           double speedup_rma = tiempo_secuencial / tiempo_rma;
+           printf("Speedup RMA: %.2fx\n", speedup_rma);
+       }
+       if (tiempo_anillo > 0 && tiempo_secuencial > 0) {
+           double speedup_anillo = tiempo_secuencial / tiempo_anillo;
+           printf("Speedup Anillo: %.2fx\n", speedup_anillo);
+       }
 
 
        if (N <= 6) {
@@ -242,7 +453,7 @@ void ejecutar_demo_paralela(int N, int rango, int tamano) {
            printf("Suma elementos - Scatter:    %.6f\n", suma_scatter);
        }
    } else {
-       liberar_matriz(C_bcast_temp); // 🟡 Liberar matriz temporal de otros procesos
+       liberar_matriz(C_anillo_temp); // 🟡 Liberar matriz temporal de otros procesos
    }
 
 
@@ -253,8 +464,12 @@ void ejecutar_demo_paralela(int N, int rango, int tamano) {
        liberar_matriz(C_secuencial);
        liberar_matriz(C_paralelo_scatter);
        liberar_matriz(C_paralelo_bcast);
+       liberar_matriz(C_paralelo_rma);
+       liberar_matriz(C_paralelo_anillo);
    }
    // 🟡 NOTA: Los otros procesos no tienen matrices que liberar (son NULL)
+
+   return correcto;
 }
 
 
@@ -263,6 +478,12 @@ int main(int argc, char* argv[]) {
    int tamano = 1;
 
 
+   // Motor de hilos: un solo proceso, sin MPI ni mpirun
+   if (argc > 1 && strcmp(argv[1], "--hilos") == 0) {
+       return ejecutar_modo_hilos(argc, argv);
+   }
+
+
    MPI_Init(&argc, &argv);
    MPI_Comm_rank(MPI_COMM_WORLD, &rango);
    MPI_Comm_size(MPI_COMM_WORLD, &tamano);
@@ -271,14 +492,32 @@ int main(int argc, char* argv[]) {
    mostrar_info_mpi(rango, tamano);
 
 
-   int N = procesar_argumentos(argc, argv, rango);
-   if (N == -1) {
+   int codigo_lote = procesar_modo_lote(argc, argv, rango);
+   if (codigo_lote != -1) {
+       MPI_Finalize();
+       return codigo_lote;
+   }
+
+
+   OpcionesDemo opciones;
+   if (!procesar_argumentos(argc, argv, rango, &opciones)) {
        MPI_Finalize();
        return EXIT_FAILURE;
    }
+   int N = opciones.n;
+
+
+   bool correcto = ejecutar_demo_paralela(N, rango, tamano, opciones.transporte, opciones.motor);
 
 
-   ejecutar_demo_paralela(N, rango, tamano);
+   // Pruebas de los módulos avanzados (--pruebas): todos los procesos
+   // participan, así que se llaman siempre antes de combinar el resultado
+   if (opciones.pruebas) {
+       correcto = comparar_cadena_mpi(N) && correcto;
+       correcto = comparar_residente_mpi(N) && correcto;
+       correcto = comparar_transporte_reducido(N) && correcto;
+       correcto = comparar_simetrica_mpi(N) && correcto;
+   }
 
 
    // 🟡 CORREGIDO: Todos los procesos deben llamar a comparar_rendimiento_mpi
@@ -286,21 +525,30 @@ int main(int argc, char* argv[]) {
        if (rango == 0) {
            printf("\n=== EJECUTANDO PRUEBAS DE RENDIMIENTO ADICIONALES ===\n");
        }
-       comparar_rendimiento_mpi(N);
+       correcto = comparar_rendimiento_mpi(N) && correcto;
    }
 
 
    if (rango == 0) {
        printf("\n=== SEMANA 2 COMPLETADA ===\n");
        printf("Resumen MPI Paralelo:\n");
-       printf("- Implementadas 2 estrategias MPI: Scatter/Gather y Broadcast\n");
+       printf("- Implementadas 4 estrategias MPI: Scatter/Gather, Broadcast, RMA y Anillo\n");
+       if (opciones.motor == MOTOR_HILOS) {
+           printf("- Motor de hilos con robo de trabajo en el proceso raíz\n");
+       }
        printf("- Tamaño de matriz: %dx%d\n", N, N);
        printf("- Procesos utilizados: %d\n", tamano);
-       printf("- Verificación numérica incluida\n");
+       if (opciones.pruebas) {
+           printf("- Producto en cadena y potencias con intermedios distribuidos\n");
+           printf("- Operando B residente (sin re-difusión si no cambia)\n");
+           printf("- Transporte en fp32, bf16 o comprimido sin pérdida (cómputo en fp64)\n");
+           printf("- Productos simétricos A·Aᵀ y Aᵀ·A con teselas triangulares equilibradas\n");
+       }
+       printf("- Verificación numérica incluida: %s\n", correcto ? "✓ EXITOSA" : "✗ FALLIDA");
        printf("- Análisis de speedup realizado\n");
    }
 
 
    MPI_Finalize();
-   return EXIT_SUCCESS;
+   return correcto ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -2,6 +2,8 @@
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
+#include <limits.h>
+#include <stdint.h>
 #include "matrix_ops.h"
 
 
@@ -15,7 +17,7 @@ double* crear_matriz(int n) {
        fprintf(stderr, "Error: Tamaño de matriz inválido (%d)\n", n);
        exit(EXIT_FAILURE);
    }
-   return (double*)calloc(n * n, sizeof(double));
+   return (double*)calloc((size_t)n * n, sizeof(double));
 }
 
 
@@ -33,7 +35,8 @@ void llenar_matriz(double* matriz, int n) {
        semilla_establecida = true;
    }
 
-   for (int i = 0; i < n * n; i++) {
+   size_t elementos = (size_t)n * n;
+   for (size_t i = 0; i < elementos; i++) {
        matriz[i] = (double)rand() / RAND_MAX * 100.0;
    }
 }
@@ -45,7 +48,7 @@ void imprimir_matriz(const double* matriz, int n) {
    printf("Matriz %dx%d:\n", n, n);
    for (int i = 0; i < n; i++) {
        for (int j = 0; j < n; j++) {
-           printf("%8.2f ", matriz[i * n + j]);
+           printf("%8.2f ", matriz[(size_t)i * n + j]);
        }
        printf("\n");
    }
@@ -55,24 +58,88 @@ void imprimir_matriz(const double* matriz, int n) {
 void multiplicar_matrices_secuencial(const double* A, const double* B, double* C, int n) {
    if (!A || !B || !C) return;
 
-   memset(C, 0, n * n * sizeof(double));
+   multiplicar_bloque_filas(A, B, C, (size_t)n, (size_t)n, (size_t)n);
+}
 
-   for (int i = 0; i < n; i++) {
-       for (int j = 0; j < n; j++) {
+
+/**
+ * Kernel local común: C (filas x columnas) = A (filas x interna) *
+ * B (interna x columnas), todas por filas. Cada elemento suma en k
+ * creciente, así que cualquier reparto por bloques de filas reproduce
+ * exactamente el resultado secuencial.
+ */
+void multiplicar_bloque_filas(const double* A, const double* B, double* C,
+                             size_t filas, size_t interna, size_t columnas) {
+   for (size_t i = 0; i < filas; i++) {
+       for (size_t j = 0; j < columnas; j++) {
            double suma = 0.0;
-           for (int k = 0; k < n; k++) {
-               suma += A[i * n + k] * B[k * n + j];
+           for (size_t k = 0; k < interna; k++) {
+               suma += A[i * interna + k] * B[k * columnas + j];
            }
-           C[i * n + j] = suma;
+           C[i * columnas + j] = suma;
        }
    }
 }
 
 
+bool guardar_matriz_binaria(const char* ruta, const double* matriz, int n) {
+   if (!ruta || !matriz || n <= 0) return false;
+
+   FILE* archivo = fopen(ruta, "wb");
+   if (!archivo) {
+       fprintf(stderr, "Error: No se pudo crear '%s'\n", ruta);
+       return false;
+   }
+
+   int64_t n64 = n;
+   size_t elementos = (size_t)n * n;
+   bool correcto = fwrite(FIRMA_MATRIZ_BINARIA, 1, 8, archivo) == 8
+                && fwrite(&n64, sizeof(n64), 1, archivo) == 1
+                && fwrite(matriz, sizeof(double), elementos, archivo) == elementos;
+
+   if (fclose(archivo) != 0) correcto = false;
+   if (!correcto) fprintf(stderr, "Error: Escritura incompleta en '%s'\n", ruta);
+   return correcto;
+}
+
+
+double* cargar_matriz_binaria(const char* ruta, int* n) {
+   if (!ruta || !n) return NULL;
+
+   FILE* archivo = fopen(ruta, "rb");
+   if (!archivo) {
+       fprintf(stderr, "Error: No se pudo abrir '%s'\n", ruta);
+       return NULL;
+   }
+
+   char firma[8];
+   int64_t n64 = 0;
+   if (fread(firma, 1, 8, archivo) != 8 || memcmp(firma, FIRMA_MATRIZ_BINARIA, 8) != 0
+       || fread(&n64, sizeof(n64), 1, archivo) != 1 || n64 <= 0 || n64 > INT_MAX) {
+       fprintf(stderr, "Error: '%s' no es una matriz binaria válida\n", ruta);
+       fclose(archivo);
+       return NULL;
+   }
+
+   *n = (int)n64;
+   double* matriz = crear_matriz(*n);
+   size_t elementos = (size_t)(*n) * (*n);
+   if (matriz && fread(matriz, sizeof(double), elementos, archivo) != elementos) {
+       fprintf(stderr, "Error: '%s' está truncado\n", ruta);
+       liberar_matriz(matriz);
+       matriz = NULL;
+   }
+
+   fclose(archivo);
+   return matriz;
+}
+
+
 double calcular_suma_matriz(const double* matriz, int n) {
    if (!matriz) return 0.0;
    double suma = 0.0;
-   for (int i = 0; i < n * n; i++) suma += matriz[i];
+   size_t elementos = (size_t)n * n;
+   for (size_t i = 0; i < elementos; i++) suma += matriz[i];
    return suma;
 }
 
@@ -80,10 +147,31 @@ double calcular_suma_matriz(const double* matriz, int n) {
 bool verificar_correccion_matriz(const double* C_secuencial, const double* C_paralelo, int n, double tolerancia) {
    if (!C_secuencial || !C_paralelo) return false;
 
-   for (int i = 0; i < n * n; i++) {
+   size_t elementos = (size_t)n * n;
+   for (size_t i = 0; i < elementos; i++) {
        if (fabs(C_secuencial[i] - C_paralelo[i]) > tolerancia) {
            return false;
        }
    }
    return true;
 }
+
+
+/**
+ * Error relativo en norma máxima: max|C_ref - C| / max|C_ref|.
+ * Útil cuando el orden de las sumas difiere del secuencial y la
+ * comparación elemento a elemento con tolerancia absoluta es demasiado estricta.
+ */
+double calcular_error_relativo(const double* C_referencia, const double* C_aproximada, int n) {
+   if (!C_referencia || !C_aproximada) return INFINITY;
+
+   double max_diferencia = 0.0;
+   double max_referencia = 0.0;
+   size_t elementos = (size_t)n * n;
+   for (size_t i = 0; i < elementos; i++) {
+       double diferencia = fabs(C_referencia[i] - C_aproximada[i]);
+       if (diferencia > max_diferencia) max_diferencia = diferencia;
+       if (fabs(C_referencia[i]) > max_referencia) max_referencia = fabs(C_referencia[i]);
+   }
+   return (max_referencia > 0.0) ? max_diferencia / max_referencia : max_diferencia;
+}
@@ -3,6 +3,12 @@
 
 
 #include <stdbool.h>
+#include <stddef.h>
+
+
+// Tolerancia absoluta de las comprobaciones exactas: todas las estrategias
+// suman en el mismo orden que la versión secuencial
+#define TOLERANCIA_VERIFICACION 1e-9
 
 
 // ============================================================================
@@ -15,6 +21,24 @@ void liberar_matriz(double* matriz);
 void llenar_matriz(double* matriz, int n);
 void imprimir_matriz(const double* matriz, int n);
 void multiplicar_matrices_secuencial(const double* A, const double* B, double* C, int n);
+void multiplicar_bloque_filas(const double* A, const double* B, double* C,
+                             size_t filas, size_t interna, size_t columnas);
+
+
+// ============================================================================
+// FORMATO BINARIO DE MATRICES
+// ============================================================================
+
+/*
+ * Cabecera de 16 bytes: firma "MATBIN01" y n como entero de 64 bits,
+ * seguida de n*n doubles en orden por filas (endianness de la máquina).
+ */
+#define FIRMA_MATRIZ_BINARIA "MATBIN01"
+#define BYTES_CABECERA_MATRIZ 16
+
+
+bool guardar_matriz_binaria(const char* ruta, const double* matriz, int n);
+double* cargar_matriz_binaria(const char* ruta, int* n);
 
 
 // ============================================================================
@@ -24,6 +48,7 @@ void multiplicar_matrices_secuencial(const double* A, const double* B, double* C
 
 bool verificar_correccion_matriz(const double* C_secuencial, const double* C_paralelo, int n, double tolerancia);
 double calcular_suma_matriz(const double* matriz, int n);
+double calcular_error_relativo(const double* C_referencia, const double* C_aproximada, int n);
 
 
 #endif
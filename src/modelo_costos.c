@@ -0,0 +1,154 @@
+#include <math.h>
+#include "mpi_ops.h"
+#include "modelo_costos.h"
+
+
+// ============================================================================
+// UTILIDADES
+// ============================================================================
+
+
+static double pasos_arbol(int procesos) {
+   return (procesos > 1) ? ceil(log2((double)procesos)) : 0.0;
+}
+
+
+const char* nombre_estrategia(EstrategiaMPI estrategia) {
+   switch (estrategia) {
+       case ESTRATEGIA_SCATTER:   return "Scatter";
+       case ESTRATEGIA_BROADCAST: return "Broadcast";
+       case ESTRATEGIA_RMA:       return "RMA";
+       case ESTRATEGIA_ANILLO:    return "Anillo";
+       default:                   return "Desconocida";
+   }
+}
+
+
+// ============================================================================
+// COLECTIVAS
+// ============================================================================
+
+/**
+ * Difusión en árbol binomial: log2(p) rondas con el mensaje completo.
+ */
+double predecir_bcast(const ModeloCostos* modelo, double bytes, int procesos) {
+   return pasos_arbol(procesos) * (modelo->alfa + bytes * modelo->beta);
+}
+
+
+/**
+ * Reparto en árbol binomial: log2(p) latencias y (p-1)/p del volumen
+ * total sale de la raíz.
+ */
+double predecir_scatterv(const ModeloCostos* modelo, double bytes_totales, int procesos) {
+   if (procesos <= 1) return 0.0;
+   return pasos_arbol(procesos) * modelo->alfa
+        + (double)(procesos - 1) / procesos * bytes_totales * modelo->beta;
+}
+
+
+double predecir_gatherv(const ModeloCostos* modelo, double bytes_totales, int procesos) {
+   return predecir_scatterv(modelo, bytes_totales, procesos);
+}
+
+
+/**
+ * Reducción en árbol binomial: en cada ronda se transfiere el vector
+ * completo y se suma elemento a elemento.
+ */
+double predecir_reduce(const ModeloCostos* modelo, double bytes, int procesos) {
+   double sumas = bytes / sizeof(double);
+   return pasos_arbol(procesos) * (modelo->alfa + bytes * modelo->beta + sumas * modelo->gamma);
+}
+
+
+// ============================================================================
+// ESTRATEGIAS DE MULTIPLICACIÓN
+// ============================================================================
+
+/**
+ * 2n³/p flops por proceso con el kernel local medido.
+ */
+double predecir_computo(const ModeloCostos* modelo, int n, int procesos) {
+   double flops = 2.0 * n * n * (double)n;
+   return flops / (procesos > 0 ? procesos : 1) * modelo->gamma;
+}
+
+
+/**
+ * Un paso del anillo envía un bloque de n²/p doubles al vecino.
+ */
+static double predecir_desplazamiento_anillo(const ModeloCostos* modelo, int n, int procesos) {
+   return modelo->alfa + (double)n * n * sizeof(double) / procesos * modelo->beta;
+}
+
+
+double predecir_comunicacion(const ModeloCostos* modelo, EstrategiaMPI estrategia, int n, int procesos) {
+   double bytes_matriz = (double)n * n * sizeof(double);
+   int p = procesos;
+
+   switch (estrategia) {
+       case ESTRATEGIA_SCATTER:
+           // Scatterv(A) + Bcast(B) + Gatherv(C)
+           return predecir_scatterv(modelo, bytes_matriz, p)
+                + predecir_bcast(modelo, bytes_matriz, p)
+                + predecir_gatherv(modelo, bytes_matriz, p);
+
+       case ESTRATEGIA_BROADCAST:
+           // Bcast(A) + Bcast(B) + Reduce(C)
+           return 2.0 * predecir_bcast(modelo, bytes_matriz, p)
+                + predecir_reduce(modelo, bytes_matriz, p);
+
+       case ESTRATEGIA_RMA: {
+           if (p <= 1) return 0.0;
+           // Mismo tamaño de tarea que multiplicar_matrices_mpi_rma
+           int filas_por_tarea = n / (p * TAREAS_POR_PROCESO_RMA);
+           if (filas_por_tarea < 1) filas_por_tarea = 1;
+           double num_tareas = ceil((double)n / filas_por_tarea);
+           double tareas_por_proceso = ceil(num_tareas / p);
+
+           // Creación y liberación colectivas de las ventanas A, B, C y contador
+           double ventanas = 4.0 * modelo->ventana;
+           // Cada operación termina con un flush: ida y vuelta (2 alfa). Por
+           // tarea Fetch_and_op, Get de A y Put de C, más el Get inicial de B
+           double latencias = (3.0 * tareas_por_proceso + 1.0) * 2.0 * modelo->alfa;
+           // Todo el volumen cruza la interfaz de la raíz: cada proceso
+           // remoto trae B completa, y entre todos traen A y escriben C
+           double bytes_raiz = (double)(p - 1) * bytes_matriz
+                             + 2.0 * (double)(p - 1) / p * bytes_matriz;
+           return ventanas + latencias + bytes_raiz * modelo->beta;
+       }
+
+       case ESTRATEGIA_ANILLO:
+           if (p <= 1) return 0.0;
+           // Scatterv(A) + Scatterv(B) + (p-1) desplazamientos de n²/p + Gatherv(C),
+           // sin descontar el solape (ver predecir_estrategia)
+           return 2.0 * predecir_scatterv(modelo, bytes_matriz, p)
+                + (p - 1) * predecir_desplazamiento_anillo(modelo, n, p)
+                + predecir_gatherv(modelo, bytes_matriz, p);
+
+       default:
+           return 0.0;
+   }
+}
+
+
+/**
+ * Tiempo total predicho: cómputo local + comunicación de la estrategia.
+ *
+ * El anillo usa doble buffer: en los p-1 primeros pasos el desplazamiento
+ * del bloque siguiente se solapa con el cómputo del actual, así que cada
+ * paso cuesta max(cómputo del bloque, desplazamiento); el último paso solo
+ * calcula. El solape supone que MPI progresa en segundo plano.
+ */
+double predecir_estrategia(const ModeloCostos* modelo, EstrategiaMPI estrategia, int n, int procesos) {
+   if (estrategia == ESTRATEGIA_ANILLO && procesos > 1) {
+       double bytes_matriz = (double)n * n * sizeof(double);
+       double bloque = predecir_computo(modelo, n, procesos) / procesos;
+       double desplazamiento = predecir_desplazamiento_anillo(modelo, n, procesos);
+       return 2.0 * predecir_scatterv(modelo, bytes_matriz, procesos)
+            + (procesos - 1) * fmax(bloque, desplazamiento) + bloque
+            + predecir_gatherv(modelo, bytes_matriz, procesos);
+   }
+   return predecir_computo(modelo, n, procesos) + predecir_comunicacion(modelo, estrategia, n, procesos);
+}
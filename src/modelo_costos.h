@@ -0,0 +1,50 @@
+#ifndef MODELO_COSTOS_H
+#define MODELO_COSTOS_H
+
+
+// ============================================================================
+// MODELO DE COSTOS ALFA-BETA-GAMMA
+// ============================================================================
+
+/*
+ * Un mensaje de m bytes cuesta alfa + m * beta y una operación de punto
+ * flotante cuesta gamma. Los parámetros se obtienen con las
+ * micro-pruebas de benchmark_red.c (ping-pong, ventanas RMA y kernel local).
+ * gamma es la del kernel del repositorio (multiplicar_bloque_filas), no la
+ * del pico de la máquina.
+ */
+typedef struct {
+   double alfa;            // Latencia por mensaje (s)
+   double beta;            // Tiempo por byte (s/B)
+   double gamma;           // Tiempo por flop del kernel local (s/flop)
+   double ventana;         // Crear y liberar una ventana RMA, colectivo (s)
+   double ancho_banda_mem; // Ancho de banda de memoria medido (B/s), informativo
+} ModeloCostos;
+
+
+typedef enum {
+   ESTRATEGIA_SCATTER = 0,
+   ESTRATEGIA_BROADCAST,
+   ESTRATEGIA_RMA,
+   ESTRATEGIA_ANILLO,
+   NUM_ESTRATEGIAS
+} EstrategiaMPI;
+
+
+const char* nombre_estrategia(EstrategiaMPI estrategia);
+
+
+// Colectivas (bytes = volumen total del mensaje o de la matriz repartida)
+double predecir_bcast(const ModeloCostos* modelo, double bytes, int procesos);
+double predecir_scatterv(const ModeloCostos* modelo, double bytes_totales, int procesos);
+double predecir_gatherv(const ModeloCostos* modelo, double bytes_totales, int procesos);
+double predecir_reduce(const ModeloCostos* modelo, double bytes, int procesos);
+
+
+// Estrategias completas de multiplicación n x n con p procesos
+double predecir_computo(const ModeloCostos* modelo, int n, int procesos);
+double predecir_comunicacion(const ModeloCostos* modelo, EstrategiaMPI estrategia, int n, int procesos);
+double predecir_estrategia(const ModeloCostos* modelo, EstrategiaMPI estrategia, int n, int procesos);
+
+
+#endif
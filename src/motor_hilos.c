@@ -0,0 +1,431 @@
+#ifdef __linux__
+#define _GNU_SOURCE  // sched_getaffinity y CPU_COUNT
+#endif
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include "matrix_ops.h"
+#include "motor_hilos.h"
+
+
+
+// ============================================================================
+// ESTADO DEL GRUPO DE HILOS
+// ============================================================================
+
+/*
+ * Cola de trabajo de un hilo: índices de tesela en [inicio, fin). El dueño
+ * toma por el final (las teselas vecinas a la última que calculó) y los
+ * ladrones por el principio, así que rara vez compiten por el mismo extremo.
+ */
+typedef struct {
+   pthread_mutex_t cerrojo;
+   int* teselas;
+   int inicio;
+   int fin;
+} ColaTrabajo;
+
+
+static struct {
+   pthread_t hilos[MAXIMO_HILOS];
+   ColaTrabajo colas[MAXIMO_HILOS];
+   int identificadores[MAXIMO_HILOS];
+   int num_hilos;
+   bool activo;
+   bool terminar;
+
+   pthread_mutex_t cerrojo;
+   pthread_cond_t hay_trabajo;
+   pthread_cond_t trabajo_terminado;
+   long generacion;
+
+   // Multiplicación en curso
+   const double* A;
+   const double* B;
+   double* C;
+   int n;
+   int bloques;
+   atomic_int pendientes;
+
+   atomic_long teselas_calculadas;
+   atomic_long robos;
+} motor = {
+   .activo = false,
+   .cerrojo = PTHREAD_MUTEX_INITIALIZER,
+   .hay_trabajo = PTHREAD_COND_INITIALIZER,
+   .trabajo_terminado = PTHREAD_COND_INITIALIZER
+};
+
+
+static double tiempo_actual(void) {
+   struct timespec t;
+   clock_gettime(CLOCK_MONOTONIC, &t);
+   return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+}
+
+
+/**
+ * Núcleos en los que este proceso puede ejecutarse. En Linux se usa la
+ * máscara de afinidad (taskset, cgroups, mpirun --bind-to), no los núcleos
+ * en línea de la máquina, para no crear más hilos que núcleos asignados.
+ */
+int obtener_nucleos_disponibles(void) {
+   long nucleos = 0;
+#ifdef __linux__
+   cpu_set_t mascara;
+   if (sched_getaffinity(0, sizeof(mascara), &mascara) == 0) {
+       nucleos = CPU_COUNT(&mascara);
+   }
+#endif
+   if (nucleos < 1) nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+   if (nucleos < 1) return 1;
+   return nucleos > MAXIMO_HILOS ? MAXIMO_HILOS : (int)nucleos;
+}
+
+
+// ============================================================================
+// KERNEL POR TESELAS
+// ============================================================================
+
+/**
+ * Calcula la tesela (bi, bj) de C recorriendo k por bloques. Dentro de la
+ * tesela se usa el orden i-k-j (acceso contiguo a B y C); cada elemento
+ * acumula sus términos en k creciente desde 0.0, igual que
+ * multiplicar_matrices_secuencial, de modo que el resultado es idéntico.
+ */
+static void calcular_tesela_c(const double* A, const double* B, double* C, int n, int tesela, int bloques) {
+   size_t nn = (size_t)n;
+   size_t i0 = (size_t)(tesela / bloques) * TAMANO_TESELA_HILOS;
+   size_t j0 = (size_t)(tesela % bloques) * TAMANO_TESELA_HILOS;
+   size_t i1 = (i0 + TAMANO_TESELA_HILOS < nn) ? i0 + TAMANO_TESELA_HILOS : nn;
+   size_t j1 = (j0 + TAMANO_TESELA_HILOS < nn) ? j0 + TAMANO_TESELA_HILOS : nn;
+
+   for (size_t i = i0; i < i1; i++) {
+       memset(C + i * nn + j0, 0, (j1 - j0) * sizeof(double));
+   }
+
+   for (size_t k0 = 0; k0 < nn; k0 += TAMANO_TESELA_HILOS) {
+       size_t k1 = (k0 + TAMANO_TESELA_HILOS < nn) ? k0 + TAMANO_TESELA_HILOS : nn;
+       for (size_t i = i0; i < i1; i++) {
+           double* fila_C = C + i * nn;
+           for (size_t k = k0; k < k1; k++) {
+               double a = A[i * nn + k];
+               const double* fila_B = B + k * nn;
+               for (size_t j = j0; j < j1; j++) {
+                   fila_C[j] += a * fila_B[j];
+               }
+           }
+       }
+   }
+}
+
+
+// ============================================================================
+// COLAS CON ROBO DE TRABAJO
+// ============================================================================
+
+
+static int tomar_propia(ColaTrabajo* cola) {
+   int tesela = -1;
+   pthread_mutex_lock(&cola->cerrojo);
+   if (cola->inicio < cola->fin) {
+       tesela = cola->teselas[--cola->fin];
+   }
+   pthread_mutex_unlock(&cola->cerrojo);
+   return tesela;
+}
+
+
+static int robar(int ladron) {
+   for (int d = 1; d < motor.num_hilos; d++) {
+       ColaTrabajo* victima = &motor.colas[(ladron + d) % motor.num_hilos];
+       int tesela = -1;
+
+       pthread_mutex_lock(&victima->cerrojo);
+       if (victima->inicio < victima->fin) {
+           tesela = victima->teselas[victima->inicio++];
+       }
+       pthread_mutex_unlock(&victima->cerrojo);
+
+       if (tesela >= 0) {
+           atomic_fetch_add(&motor.robos, 1);
+           return tesela;
+       }
+   }
+   return -1;
+}
+
+
+static void* bucle_hilo(void* argumento) {
+   int id = *(const int*)argumento;
+   long generacion_vista = 0;
+
+   pthread_mutex_lock(&motor.cerrojo);
+   while (true) {
+       while (!motor.terminar && motor.generacion == generacion_vista) {
+           pthread_cond_wait(&motor.hay_trabajo, &motor.cerrojo);
+       }
+       if (motor.terminar) break;
+       generacion_vista = motor.generacion;
+       pthread_mutex_unlock(&motor.cerrojo);
+
+       // Los datos de la multiplicación se publican antes de llenar las
+       // colas; el cerrojo de la cola garantiza que se ven actualizados
+       while (true) {
+           int tesela = tomar_propia(&motor.colas[id]);
+           if (tesela < 0) tesela = robar(id);
+           if (tesela < 0) break;
+
+           calcular_tesela_c(motor.A, motor.B, motor.C, motor.n, tesela, motor.bloques);
+           atomic_fetch_add(&motor.teselas_calculadas, 1);
+
+           if (atomic_fetch_sub(&motor.pendientes, 1) == 1) {
+               pthread_mutex_lock(&motor.cerrojo);
+               pthread_cond_signal(&motor.trabajo_terminado);
+               pthread_mutex_unlock(&motor.cerrojo);
+           }
+       }
+
+       pthread_mutex_lock(&motor.cerrojo);
+   }
+   pthread_mutex_unlock(&motor.cerrojo);
+   return NULL;
+}
+
+
+// ============================================================================
+// CICLO DE VIDA DEL GRUPO
+// ============================================================================
+
+/**
+ * Crea el grupo persistente con num_hilos hilos (0 = uno por núcleo). Si ya
+ * existía con otro tamaño, se detiene y se vuelve a crear.
+ */
+bool iniciar_motor_hilos(int num_hilos) {
+   if (num_hilos <= 0) num_hilos = obtener_nucleos_disponibles();
+   if (num_hilos > MAXIMO_HILOS) num_hilos = MAXIMO_HILOS;
+
+   if (motor.activo) {
+       if (motor.num_hilos == num_hilos) return true;
+       detener_motor_hilos();
+   }
+
+   motor.num_hilos = num_hilos;
+   motor.terminar = false;
+   motor.generacion = 0;
+   atomic_init(&motor.pendientes, 0);
+   atomic_init(&motor.teselas_calculadas, 0);
+   atomic_init(&motor.robos, 0);
+
+   for (int h = 0; h < num_hilos; h++) {
+       pthread_mutex_init(&motor.colas[h].cerrojo, NULL);
+       motor.colas[h].teselas = NULL;
+       motor.colas[h].inicio = 0;
+       motor.colas[h].fin = 0;
+   }
+
+   for (int h = 0; h < num_hilos; h++) {
+       motor.identificadores[h] = h;
+       if (pthread_create(&motor.hilos[h], NULL, bucle_hilo, &motor.identificadores[h]) != 0) {
+           fprintf(stderr, "Error: No se pudo crear el hilo %d\n", h);
+           motor.num_hilos = h;
+           motor.activo = true;
+           detener_motor_hilos();
+           return false;
+       }
+   }
+
+   motor.activo = true;
+   return true;
+}
+
+
+void detener_motor_hilos(void) {
+   if (!motor.activo) return;
+
+   pthread_mutex_lock(&motor.cerrojo);
+   motor.terminar = true;
+   pthread_cond_broadcast(&motor.hay_trabajo);
+   pthread_mutex_unlock(&motor.cerrojo);
+
+   for (int h = 0; h < motor.num_hilos; h++) {
+       pthread_join(motor.hilos[h], NULL);
+   }
+   for (int h = 0; h < motor.num_hilos; h++) {
+       pthread_mutex_destroy(&motor.colas[h].cerrojo);
+       free(motor.colas[h].teselas);
+       motor.colas[h].teselas = NULL;
+   }
+
+   motor.activo = false;
+   motor.num_hilos = 0;
+}
+
+
+int obtener_hilos_motor(void) {
+   return motor.activo ? motor.num_hilos : 0;
+}
+
+
+EstadisticasHilos obtener_estadisticas_hilos(void) {
+   EstadisticasHilos e = {0, 0};
+   if (motor.activo) {
+       e.teselas = atomic_load(&motor.teselas_calculadas);
+       e.robos = atomic_load(&motor.robos);
+   }
+   return e;
+}
+
+
+// ============================================================================
+// MULTIPLICACIÓN CON EL MOTOR DE HILOS
+// ============================================================================
+
+/**
+ * C = A·B repartiendo las teselas de C entre los hilos del grupo. Cada cola
+ * recibe un tramo contiguo de teselas (misma franja de A) y el robo corrige
+ * los desequilibrios. El hilo que llama espera a que terminen todas.
+ *
+ * Parámetros:
+ *  A : Matriz A completa (compartida por todos los hilos).
+ *  B : Matriz B completa (compartida por todos los hilos).
+ *  C : Matriz de salida.
+ *  n : Dimensión de las matrices cuadradas (n x n).
+ */
+void multiplicar_matrices_hilos(const double* A, const double* B, double* C, int n) {
+   if (!A || !B || !C || n <= 0) return;
+   if (!motor.activo && !iniciar_motor_hilos(0)) {
+       multiplicar_matrices_secuencial(A, B, C, n);
+       return;
+   }
+
+   int bloques = (n + TAMANO_TESELA_HILOS - 1) / TAMANO_TESELA_HILOS;
+   int total = bloques * bloques;
+   int hilos = motor.num_hilos;
+
+   motor.A = A;
+   motor.B = B;
+   motor.C = C;
+   motor.n = n;
+   motor.bloques = bloques;
+   atomic_store(&motor.pendientes, total);
+
+   for (int h = 0; h < hilos; h++) {
+       int inicio = (int)((long)total * h / hilos);
+       int fin = (int)((long)total * (h + 1) / hilos);
+       ColaTrabajo* cola = &motor.colas[h];
+
+       pthread_mutex_lock(&cola->cerrojo);
+       free(cola->teselas);
+       cola->teselas = (int*)malloc((fin > inicio ? fin - inicio : 1) * sizeof(int));
+       if (!cola->teselas) {
+           pthread_mutex_unlock(&cola->cerrojo);
+           fprintf(stderr, "Error en asignación de memoria\n");
+           exit(EXIT_FAILURE);
+       }
+       // Se guardan al revés para que el dueño empiece por la primera tesela
+       for (int t = inicio; t < fin; t++) {
+           cola->teselas[fin - 1 - t] = t;
+       }
+       cola->inicio = 0;
+       cola->fin = fin - inicio;
+       pthread_mutex_unlock(&cola->cerrojo);
+   }
+
+   pthread_mutex_lock(&motor.cerrojo);
+   motor.generacion++;
+   pthread_cond_broadcast(&motor.hay_trabajo);
+   while (atomic_load(&motor.pendientes) > 0) {
+       pthread_cond_wait(&motor.trabajo_terminado, &motor.cerrojo);
+   }
+   pthread_mutex_unlock(&motor.cerrojo);
+}
+
+
+// ============================================================================
+// PRUEBAS
+// ============================================================================
+
+/**
+ * Escalado del motor de hilos con 1, 2, 4, ... hasta maximo_hilos hilos
+ * (0 = núcleos disponibles), con el mismo informe que la demo MPI: tiempo,
+ * verificación frente a la versión secuencial y speedup. No usa MPI.
+ */
+bool comparar_motor_hilos(int n, int maximo_hilos) {
+   if (maximo_hilos <= 0) maximo_hilos = obtener_nucleos_disponibles();
+   if (maximo_hilos > MAXIMO_HILOS) maximo_hilos = MAXIMO_HILOS;
+
+   printf("\n=== MOTOR DE HILOS - MEMORIA COMPARTIDA ===\n");
+   printf("Tamaño de matriz: %dx%d\n", n, n);
+   printf("Núcleos disponibles: %d, hilos máximos: %d\n", obtener_nucleos_disponibles(), maximo_hilos);
+   printf("Tesela de C: %dx%d\n", TAMANO_TESELA_HILOS, TAMANO_TESELA_HILOS);
+
+   double* A = crear_matriz(n);
+   double* B = crear_matriz(n);
+   double* C_secuencial = crear_matriz(n);
+   double* C_hilos = crear_matriz(n);
+   if (!A || !B || !C_secuencial || !C_hilos) {
+       fprintf(stderr, "Error: Falló la asignación de memoria\n");
+       liberar_matriz(A);
+       liberar_matriz(B);
+       liberar_matriz(C_secuencial);
+       liberar_matriz(C_hilos);
+       return false;
+   }
+   llenar_matriz(A, n);
+   llenar_matriz(B, n);
+
+   printf("\n🔴 EJECUTANDO MULTIPLICACIÓN SECUENCIAL...\n");
+   double inicio = tiempo_actual();
+   multiplicar_matrices_secuencial(A, B, C_secuencial, n);
+   double tiempo_secuencial = tiempo_actual() - inicio;
+   printf("Tiempo secuencial: %.6f segundos\n", tiempo_secuencial);
+
+   printf("\n=== ANÁLISIS DE RENDIMIENTO ===\n");
+   printf("%-8s %14s %10s %12s %10s\n", "Hilos", "Tiempo (s)", "Speedup", "Eficiencia", "Robos");
+
+   bool correcto = true;
+   for (int hilos = 1; ; hilos *= 2) {
+       if (hilos > maximo_hilos) hilos = maximo_hilos;
+
+       double arranque = tiempo_actual();
+       if (!iniciar_motor_hilos(hilos)) {
+           correcto = false;
+           break;
+       }
+       arranque = tiempo_actual() - arranque;
+
+       long robos_previos = obtener_estadisticas_hilos().robos;
+       memset(C_hilos, 0, (size_t)n * n * sizeof(double));
+
+       inicio = tiempo_actual();
+       multiplicar_matrices_hilos(A, B, C_hilos, n);
+       double tiempo = tiempo_actual() - inicio;
+
+       bool hilos_correcto = verificar_correccion_matriz(C_secuencial, C_hilos, n, TOLERANCIA_VERIFICACION);
+       correcto = correcto && hilos_correcto;
+
+       double speedup = tiempo > 0 ? tiempo_secuencial / tiempo : 0.0;
+       printf("%-8d %14.6f %9.2fx %11.0f%% %10ld %s (arranque %.2e s)\n", hilos, tiempo, speedup,
+              100.0 * speedup / hilos, obtener_estadisticas_hilos().robos - robos_previos,
+              hilos_correcto ? "✓" : "✗", arranque);
+
+       if (hilos == maximo_hilos) break;
+   }
+
+   printf("Verificación Hilos: %s\n", correcto ? "✓ EXITOSA" : "✗ FALLIDA");
+
+   detener_motor_hilos();
+   liberar_matriz(A);
+   liberar_matriz(B);
+   liberar_matriz(C_secuencial);
+   liberar_matriz(C_hilos);
+   return correcto;
+}
@@ -0,0 +1,52 @@
+#ifndef MOTOR_HILOS_H
+#define MOTOR_HILOS_H
+
+
+#include <stdbool.h>
+
+
+// ============================================================================
+// CONFIGURACIÓN
+// ============================================================================
+#define TAMANO_TESELA_HILOS 64  // Teselas de 64x64 doubles (32 KiB por bloque)
+#define MAXIMO_HILOS 256
+
+
+// ============================================================================
+// MOTOR DE HILOS - Memoria compartida, sin mpirun
+// ============================================================================
+
+/*
+ * Grupo persistente de pthreads con una cola de trabajo por hilo. C se parte
+ * en teselas de TAMANO_TESELA_HILOS; cada hilo consume su cola por el final
+ * y, cuando se vacía, roba teselas del principio de la cola de otro hilo.
+ * Solo existe una copia de A y B, compartida por todos los hilos.
+ *
+ * multiplicar_matrices_hilos tiene la misma firma que las estrategias MPI;
+ * si el grupo no está iniciado, se inicia con un hilo por núcleo disponible.
+ */
+
+typedef struct {
+   long teselas;  // Teselas calculadas desde el inicio del grupo
+   long robos;    // Teselas obtenidas de la cola de otro hilo
+} EstadisticasHilos;
+
+
+bool iniciar_motor_hilos(int num_hilos);
+void detener_motor_hilos(void);
+int obtener_hilos_motor(void);
+int obtener_nucleos_disponibles(void);
+
+void multiplicar_matrices_hilos(const double* A, const double* B, double* C, int n);
+EstadisticasHilos obtener_estadisticas_hilos(void);
+
+
+// ============================================================================
+// PRUEBAS
+// ============================================================================
+
+
+bool comparar_motor_hilos(int n, int maximo_hilos);
+
+
+#endif
@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "mpi_grande.h"
+
+
+// ============================================================================
+// TIPO DERIVADO "FILA"
+// ============================================================================
+
+/**
+ * Tipo contiguo de n doubles: una fila de una matriz de n columnas.
+ */
+MPI_Datatype crear_tipo_fila(int n) {
+   MPI_Datatype tipo;
+   MPI_Type_contiguous(n, MPI_DOUBLE, &tipo);
+   MPI_Type_commit(&tipo);
+   return tipo;
+}
+
+
+void liberar_tipo_fila(MPI_Datatype* tipo) {
+   if (tipo && *tipo != MPI_DATATYPE_NULL) {
+       MPI_Type_free(tipo);
+   }
+}
+
+
+// ============================================================================
+// COLECTIVAS SOBRE MATRICES COMPLETAS
+// ============================================================================
+
+/**
+ * MPI_Bcast de un número arbitrario de doubles.
+ */
+int bcast_grande(double* buffer, size_t elementos, int raiz) {
+#if MPI_VERSION >= 4
+   return MPI_Bcast_c(buffer, (MPI_Count)elementos, MPI_DOUBLE, raiz, MPI_COMM_WORLD);
+#else
+   // Todos los procesos conocen elementos, así que parten igual
+   for (size_t inicio = 0; inicio < elementos; inicio += CONTEO_MAXIMO_MPI) {
+       size_t restante = elementos - inicio;
+       int trozo = (int)(restante < CONTEO_MAXIMO_MPI ? restante : CONTEO_MAXIMO_MPI);
+       int codigo = MPI_Bcast(buffer + inicio, trozo, MPI_DOUBLE, raiz, MPI_COMM_WORLD);
+       if (codigo != MPI_SUCCESS) return codigo;
+   }
+   return MPI_SUCCESS;
+#endif
+}
+
+
+/**
+ * MPI_Reduce con MPI_SUM de un número arbitrario de doubles. Las operaciones
+ * predefinidas no admiten tipos derivados, por eso aquí se parte en trozos
+ * en lugar de usar el tipo "fila".
+ */
+int reduce_suma_grande(const double* envio, double* recepcion, size_t elementos, int raiz) {
+#if MPI_VERSION >= 4
+   return MPI_Reduce_c(envio, recepcion, (MPI_Count)elementos, MPI_DOUBLE, MPI_SUM, raiz, MPI_COMM_WORLD);
+#else
+   int rango;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+
+   for (size_t inicio = 0; inicio < elementos; inicio += CONTEO_MAXIMO_MPI) {
+       size_t restante = elementos - inicio;
+       int trozo = (int)(restante < CONTEO_MAXIMO_MPI ? restante : CONTEO_MAXIMO_MPI);
+       int codigo = MPI_Reduce(envio + inicio, rango == raiz ? recepcion + inicio : NULL,
+                               trozo, MPI_DOUBLE, MPI_SUM, raiz, MPI_COMM_WORLD);
+       if (codigo != MPI_SUCCESS) return codigo;
+   }
+   return MPI_SUCCESS;
+#endif
+}
+
+
+// ============================================================================
+// COLECTIVAS POR BLOQUES DE FILAS
+// ============================================================================
+
+/**
+ * MPI_Scatterv de bloques de filas: filas[i] filas a partir de la fila
+ * desplazamientos[i] de envio (solo relevante en la raíz) van al proceso i.
+ */
+int scatterv_filas(const double* envio, const int* filas, const int* desplazamientos,
+                   double* recepcion, int n, int raiz) {
+   int rango;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+
+   MPI_Datatype fila = crear_tipo_fila(n);
+   int codigo = MPI_Scatterv(envio, filas, desplazamientos, fila,
+                             recepcion, filas[rango], fila, raiz, MPI_COMM_WORLD);
+   liberar_tipo_fila(&fila);
+   return codigo;
+}
+
+
+int gatherv_filas(const double* envio, double* recepcion, const int* filas,
+                  const int* desplazamientos, int n, int raiz) {
+   int rango;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+
+   MPI_Datatype fila = crear_tipo_fila(n);
+   int codigo = MPI_Gatherv(envio, filas[rango], fila,
+                            recepcion, filas, desplazamientos, fila, raiz, MPI_COMM_WORLD);
+   liberar_tipo_fila(&fila);
+   return codigo;
+}
+
+
+int allgatherv_filas(const double* envio, double* recepcion, const int* filas,
+                     const int* desplazamientos, int n) {
+   int rango;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+
+   MPI_Datatype fila = crear_tipo_fila(n);
+   int codigo = MPI_Allgatherv(envio, filas[rango], fila,
+                               recepcion, filas, desplazamientos, fila, MPI_COMM_WORLD);
+   liberar_tipo_fila(&fila);
+   return codigo;
+}
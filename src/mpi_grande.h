@@ -0,0 +1,53 @@
+#ifndef MPI_GRANDE_H
+#define MPI_GRANDE_H
+
+
+#include <limits.h>
+#include <stddef.h>
+#include "mpi_simulado.h"
+
+
+// ============================================================================
+// CONFIGURACIÓN
+// ============================================================================
+
+/*
+ * Máximo de elementos por llamada MPI cuando no hay colectivas de conteo
+ * grande (MPI < 4). Se puede reducir al compilar (-DCONTEO_MAXIMO_MPI=1000)
+ * para ejercitar el particionado con matrices pequeñas.
+ */
+#ifndef CONTEO_MAXIMO_MPI
+#define CONTEO_MAXIMO_MPI INT_MAX
+#endif
+
+
+// ============================================================================
+// TRANSFERENCIAS DE CONTEO GRANDE (64 BITS)
+// ============================================================================
+
+/*
+ * Las transferencias de matrices completas usan conteos size_t: con MPI-4 se
+ * delegan en MPI_Bcast_c / MPI_Reduce_c y, si no, se parten en trozos de
+ * CONTEO_MAXIMO_MPI elementos.
+ *
+ * Las transferencias por bloques de filas usan un tipo derivado "fila" de n
+ * doubles, de modo que los conteos y desplazamientos se expresan en filas
+ * (siempre <= n) y nunca desbordan un int. Los arreglos filas/desplazamientos
+ * deben ser válidos en todos los procesos.
+ */
+
+MPI_Datatype crear_tipo_fila(int n);
+void liberar_tipo_fila(MPI_Datatype* tipo);
+
+int bcast_grande(double* buffer, size_t elementos, int raiz);
+int reduce_suma_grande(const double* envio, double* recepcion, size_t elementos, int raiz);
+
+int scatterv_filas(const double* envio, const int* filas, const int* desplazamientos,
+                   double* recepcion, int n, int raiz);
+int gatherv_filas(const double* envio, double* recepcion, const int* filas,
+                  const int* desplazamientos, int n, int raiz);
+int allgatherv_filas(const double* envio, double* recepcion, const int* filas,
+                     const int* desplazamientos, int n);
+
+
+#endif
@@ -4,55 +4,8 @@
 #include <math.h>
 #include "matrix_ops.h"
 #include "mpi_ops.h"
-
-
-#ifdef __linux__
-#include <mpi.h>
-#else
-// Definiciones para Windows (simuladas)
-typedef int MPI_Datatype;
-#define MPI_DOUBLE 0
-#define MPI_INT 0
-#define MPI_SUM 0
-
-
-static inline int MPI_Scatterv(const void* sendbuf, const int* sendcounts, const int* displacements,
-                             MPI_Datatype sendtype, void* recvbuf, int recvcount,
-                             MPI_Datatype recvtype, int root, Comunicador_MPI comm) {
-   if (root == 0 && recvbuf && sendbuf) {
-       memcpy(recvbuf, (char*)sendbuf + displacements[0] * sizeof(double), recvcount * sizeof(double));
-   }
-   return 0;
-}
-
-
-static inline int MPI_Gatherv(const void* sendbuf, int sendcount, MPI_Datatype sendtype,
-                            void* recvbuf, const int* recvcounts, const int* displacements,
-                            MPI_Datatype recvtype, int root, Comunicador_MPI comm) {
-   if (root == 0 && recvbuf && sendbuf) {
-       memcpy((char*)recvbuf + displacements[0] * sizeof(double), sendbuf, sendcount * sizeof(double));
-   }
-   return 0;
-}
-
-
-static inline int MPI_Bcast(void* buffer, int count, MPI_Datatype datatype,
-                          int root, Comunicador_MPI comm) {
-   return 0;
-}
-
-
-static inline int MPI_Reduce(const void* sendbuf, void* recvbuf, int count,
-                           MPI_Datatype datatype, int op, int root, Comunicador_MPI comm) {
-   if (root == 0 && recvbuf && sendbuf) {
-       memcpy(recvbuf, sendbuf, count * sizeof(double));
-   }
-   return 0;
-}
-#endif
-
-
-#define TOLERANCIA_VERIFICACION 1e-9
+#include "mpi_grande.h"
+#include "mpi_simulado.h"
 
 
 // ============================================================================
@@ -73,6 +26,17 @@ static inline int MPI_Reduce(const void* sendbuf, void* recvbuf, int count,
  *  n : Dimensión de las matrices cuadradas (n x n).
  */
 void multiplicar_matrices_mpi_scatter(const double* A, const double* B, double* C, int n) {
+   multiplicar_matrices_mpi_scatter_formato(A, B, C, n, TRANSPORTE_FP64, NULL);
+}
+
+
+/**
+ * multiplicar_matrices_mpi_scatter con A, B y C viajando en el formato de
+ * transporte indicado (el cómputo local sigue en fp64). estadisticas
+ * (puede ser NULL) acumula en el raíz los bytes enviados.
+ */
+void multiplicar_matrices_mpi_scatter_formato(const double* A, const double* B, double* C, int n,
+                                             FormatoTransporte formato, EstadisticasTransporte* estadisticas) {
    int rango, tamano;
    MPI_Comm_rank(MPI_COMM_WORLD, &rango);
    MPI_Comm_size(MPI_COMM_WORLD, &tamano);
@@ -82,124 +46,59 @@ void multiplicar_matrices_mpi_scatter(const double* A, const double* B, double*
    int filas_base = n / tamano;
    int filas_extra = n % tamano;
    int filas_local = filas_base + (rango < filas_extra ? 1 : 0);
-   int desplazamiento = 0;
+   size_t elementos_local = (size_t)filas_local * n;
+   size_t elementos_matriz = (size_t)n * n;
 
 
-   // Calcular desplazamiento para este proceso
-   for (int i = 0; i < rango; i++) {
-       desplazamiento += filas_base + (i < filas_extra ? 1 : 0);
-   }
+   // Buffers locales (B siempre completa: MPI_Bcast exige el mismo conteo en
+   // todos los procesos, incluso en los que no tienen filas)
+   double* A_local = (double*)malloc((elementos_local > 0 ? elementos_local : 1) * sizeof(double));
+   double* B_local = (double*)malloc(elementos_matriz * sizeof(double));
+   double* C_local = (double*)calloc(elementos_local > 0 ? elementos_local : 1, sizeof(double));
 
 
-   // Buffers locales
-   double* A_local = NULL;
-   double* B_local = NULL;
-   double* C_local = NULL;
+   // Distribución en filas: los conteos nunca superan n, así que caben en int
+   int* filas_proceso = (int*)malloc(tamano * sizeof(int));
+   int* desplazamientos = (int*)malloc(tamano * sizeof(int));
 
 
-   // Solo asignar memoria si este proceso tiene trabajo que hacer
-   if (filas_local > 0) {
-       A_local = (double*)malloc(filas_local * n * sizeof(double));
-       B_local = (double*)malloc(n * n * sizeof(double));
-       C_local = (double*)calloc(filas_local * n, sizeof(double));
-   }
-
-
-   if ((filas_local > 0) && (!A_local || !B_local || !C_local)) {
+   if (!A_local || !B_local || !C_local || !filas_proceso || !desplazamientos) {
        fprintf(stderr, "Proceso %d: Error en asignación de memoria\n", rango);
        MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
        return;
    }
 
 
-   // Distribuir filas de A usando Scatterv
-   int* sendcounts = NULL;
-   int* displacements = NULL;
-
-
-   if (rango == 0) {
-       sendcounts = (int*)malloc(tamano * sizeof(int));
-       displacements = (int*)malloc(tamano * sizeof(int));
-
-
-       int offset = 0;
-       for (int i = 0; i < tamano; i++) {
-           int filas_proc = filas_base + (i < filas_extra ? 1 : 0);
-           sendcounts[i] = filas_proc * n;
-           displacements[i] = offset;
-           offset += sendcounts[i];
-       }
+   int offset = 0;
+   for (int i = 0; i < tamano; i++) {
+       filas_proceso[i] = filas_base + (i < filas_extra ? 1 : 0);
+       desplazamientos[i] = offset;
+       offset += filas_proceso[i];
    }
 
 
-   // Scatter de A (solo si este proceso tiene trabajo)
-   if (filas_local > 0) {
-       MPI_Scatterv(A, sendcounts, displacements, MPI_DOUBLE,
-                   A_local, filas_local * n, MPI_DOUBLE,
-                   0, MPI_COMM_WORLD);
-   } else {
-       // Proceso sin trabajo - participar en scatter con buffer dummy
-       double dummy;
-       MPI_Scatterv(A, sendcounts, displacements, MPI_DOUBLE,
-                   &dummy, 0, MPI_DOUBLE, 0, MPI_COMM_WORLD);
-   }
+   // Scatter de A por bloques de filas
+   repartir_codificada(A, A_local, filas_proceso, desplazamientos, n, formato, estadisticas);
 
 
    // Broadcast de B completa a todos los procesos
-   if (filas_local > 0) {
-       // 🟡 CORREGIDO: Crear buffer no-const para Bcast
-       double* B_temp = (double*)malloc(n * n * sizeof(double));
-       if (rango == 0) {
-           memcpy(B_temp, B, n * n * sizeof(double));
-       }
-       MPI_Bcast(B_temp, n * n, MPI_DOUBLE, 0, MPI_COMM_WORLD);
-       memcpy(B_local, B_temp, n * n * sizeof(double));
-       free(B_temp);
-   } else {
-       // Proceso sin trabajo - participar en broadcast con buffer dummy
-       double dummy;
-       MPI_Bcast(&dummy, 0, MPI_DOUBLE, 0, MPI_COMM_WORLD);
-   }
+   difundir_codificada(B, B_local, n, formato, estadisticas);
 
 
-   // Multiplicación local (solo si este proceso tiene trabajo)
-   if (filas_local > 0) {
-       for (int i_local = 0; i_local < filas_local; i_local++) {
-           for (int j = 0; j < n; j++) {
-               double suma = 0.0;
-               for (int k = 0; k < n; k++) {
-                   suma += A_local[i_local * n + k] * B_local[k * n + j];
-               }
-               C_local[i_local * n + j] = suma;
-           }
-       }
-   }
+   // Multiplicación local
+   multiplicar_bloque_filas(A_local, B_local, C_local, (size_t)filas_local, (size_t)n, (size_t)n);
 
 
    // Recopilar resultados con Gatherv
-   if (filas_local > 0) {
-       MPI_Gatherv(C_local, filas_local * n, MPI_DOUBLE,
-                  C, sendcounts, displacements, MPI_DOUBLE,
-                  0, MPI_COMM_WORLD);
-   } else {
-       // Proceso sin trabajo - participar en gather con buffer dummy
-       double dummy;
-       MPI_Gatherv(&dummy, 0, MPI_DOUBLE,
-                  C, sendcounts, displacements, MPI_DOUBLE,
-                  0, MPI_COMM_WORLD);
-   }
+   recolectar_codificada(C_local, C, filas_proceso, desplazamientos, n, formato, estadisticas);
 
 
    // Limpiar
-   if (filas_local > 0) {
-       free(A_local);
-       free(B_local);
-       free(C_local);
-   }
-   if (rango == 0) {
-       free(sendcounts);
-       free(displacements);
-   }
+   free(A_local);
+   free(B_local);
+   free(C_local);
+   free(filas_proceso);
+   free(desplazamientos);
 }
 
 
@@ -214,15 +113,27 @@ void multiplicar_matrices_mpi_scatter(const double* A, const double* B, double*
  */
 
 void multiplicar_matrices_mpi_broadcast(const double* A, const double* B, double* C, int n) {
+   multiplicar_matrices_mpi_broadcast_formato(A, B, C, n, TRANSPORTE_FP64, NULL);
+}
+
+
+/**
+ * multiplicar_matrices_mpi_broadcast con A, B y C viajando en el formato de
+ * transporte indicado (el cómputo local sigue en fp64). estadisticas
+ * (puede ser NULL) acumula en el raíz los bytes enviados.
+ */
+void multiplicar_matrices_mpi_broadcast_formato(const double* A, const double* B, double* C, int n,
+                                               FormatoTransporte formato, EstadisticasTransporte* estadisticas) {
    int rango, tamano;
    MPI_Comm_rank(MPI_COMM_WORLD, &rango);
    MPI_Comm_size(MPI_COMM_WORLD, &tamano);
 
 
    // Buffers locales para cada proceso
-   double* A_local = (double*)malloc(n * n * sizeof(double));
-   double* B_local = (double*)malloc(n * n * sizeof(double));
-   double* C_local = (double*)calloc(n * n, sizeof(double));
+   size_t elementos_matriz = (size_t)n * n;
+   double* A_local = (double*)malloc(elementos_matriz * sizeof(double));
+   double* B_local = (double*)malloc(elementos_matriz * sizeof(double));
+   double* C_local = (double*)calloc(elementos_matriz, sizeof(double));
 
 
    if (!A_local || !B_local || !C_local) {
@@ -232,16 +143,10 @@ void multiplicar_matrices_mpi_broadcast(const double* A, const double* B, double
    }
 
 
-   // Proceso 0 copia los datos, otros procesos reciben via broadcast
-   if (rango == 0) {
-       memcpy(A_local, A, n * n * sizeof(double));
-       memcpy(B_local, B, n * n * sizeof(double));
-   }
-
-
-   // Broadcast de ambas matrices
-   MPI_Bcast(A_local, n * n, MPI_DOUBLE, 0, MPI_COMM_WORLD);
-   MPI_Bcast(B_local, n * n, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+   // Broadcast de ambas matrices: el raíz también las copia (o decodifica)
+   // en sus buffers locales
+   difundir_codificada(A, A_local, n, formato, estadisticas);
+   difundir_codificada(B, B_local, n, formato, estadisticas);
 
 
    // Distribuir trabajo por filas
@@ -258,19 +163,137 @@ void multiplicar_matrices_mpi_broadcast(const double* A, const double* B, double
 
 
    // Multiplicación de las filas asignadas
-   for (int i = inicio; i < fin; i++) {
-       for (int j = 0; j < n; j++) {
-           double suma = 0.0;
-           for (int k = 0; k < n; k++) {
-               suma += A_local[i * n + k] * B_local[k * n + j];
+   multiplicar_bloque_filas(A_local + (size_t)inicio * n, B_local, C_local + (size_t)inicio * n,
+                            (size_t)(fin - inicio), (size_t)n, (size_t)n);
+
+
+   // Reducir resultados al proceso 0
+   reducir_codificada(C_local, C, n, formato, estadisticas);
+
+
+   free(A_local);
+   free(B_local);
+   free(C_local);
+}
+
+
+// ============================================================================
+// IMPLEMENTACIÓN RMA - Comunicación unilateral con reparto dinámico
+// ============================================================================
+/**
+ * El proceso raíz expone A, B y C mediante ventanas MPI_Win_create y un
+ * contador de tareas compartido. Cada proceso (incluido el raíz) toma la
+ * siguiente tarea con MPI_Fetch_and_op, trae con MPI_Get las filas de A
+ * correspondientes (y B completa una sola vez), calcula su bloque y lo
+ * escribe en C con MPI_Put. Todo el acceso es de objetivo pasivo: el raíz
+ * no coordina y los procesos que terminan antes toman más tareas.
+ *
+ * Las tareas son bloques de filas consecutivas, dimensionados para que haya
+ * TAREAS_POR_PROCESO_RMA tareas por proceso y así equilibrar la carga.
+ */
+void multiplicar_matrices_mpi_rma(const double* A, const double* B, double* C, int n) {
+   int rango, tamano;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+   MPI_Comm_size(MPI_COMM_WORLD, &tamano);
+
+
+   // Con un solo proceso no hay a quién exponer memoria: calcular directamente
+   if (tamano == 1) {
+       multiplicar_matrices_secuencial(A, B, C, n);
+       return;
+   }
+
+
+   // Tamaño de tarea: unas pocas tareas por proceso
+   int filas_por_tarea = n / (tamano * TAREAS_POR_PROCESO_RMA);
+   if (filas_por_tarea < 1) filas_por_tarea = 1;
+   int num_tareas = (n + filas_por_tarea - 1) / filas_por_tarea;
+
+
+   // Solo el raíz expone memoria; el resto crea ventanas vacías
+   MPI_Aint bytes_matriz = (rango == 0) ? (MPI_Aint)n * n * sizeof(double) : 0;
+   int contador = 0;
+   MPI_Win ventana_A, ventana_B, ventana_C, ventana_contador;
+
+   MPI_Win_create(rango == 0 ? (void*)A : NULL, bytes_matriz, sizeof(double),
+                  MPI_INFO_NULL, MPI_COMM_WORLD, &ventana_A);
+   MPI_Win_create(rango == 0 ? (void*)B : NULL, bytes_matriz, sizeof(double),
+                  MPI_INFO_NULL, MPI_COMM_WORLD, &ventana_B);
+   MPI_Win_create(rango == 0 ? C : NULL, bytes_matriz, sizeof(double),
+                  MPI_INFO_NULL, MPI_COMM_WORLD, &ventana_C);
+   MPI_Win_create(rango == 0 ? &contador : NULL, rango == 0 ? (MPI_Aint)sizeof(int) : 0, sizeof(int),
+                  MPI_INFO_NULL, MPI_COMM_WORLD, &ventana_contador);
+
+
+   double* A_local = (double*)malloc((size_t)filas_por_tarea * n * sizeof(double));
+   double* B_local = NULL;
+   double* C_local = (double*)malloc((size_t)filas_por_tarea * n * sizeof(double));
+
+   // Las transferencias se expresan en filas para que los conteos quepan en int
+   MPI_Datatype fila = crear_tipo_fila(n);
+
+   if (!A_local || !C_local) {
+       fprintf(stderr, "Proceso %d: Error en asignación de memoria\n", rango);
+       MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+       return;
+   }
+
+
+   MPI_Win_lock(MPI_LOCK_SHARED, 0, 0, ventana_contador);
+   MPI_Win_lock(MPI_LOCK_SHARED, 0, 0, ventana_A);
+   MPI_Win_lock(MPI_LOCK_SHARED, 0, 0, ventana_C);
+
+   const int incremento = 1;
+   while (1) {
+       // Tomar la siguiente tarea de forma atómica
+       int tarea;
+       MPI_Fetch_and_op(&incremento, &tarea, MPI_INT, 0, 0, MPI_SUM, ventana_contador);
+       MPI_Win_flush(0, ventana_contador);
+       if (tarea >= num_tareas) break;
+
+
+       // B completa solo se trae si este proceso llega a tener trabajo
+       if (!B_local) {
+           B_local = (double*)malloc((size_t)n * n * sizeof(double));
+           if (!B_local) {
+               fprintf(stderr, "Proceso %d: Error en asignación de memoria\n", rango);
+               MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+               return;
            }
-           C_local[i * n + j] = suma;
+           MPI_Win_lock(MPI_LOCK_SHARED, 0, 0, ventana_B);
+           MPI_Get(B_local, n, fila, 0, 0, n, fila, ventana_B);
+           MPI_Win_unlock(0, ventana_B);
        }
+
+
+       int fila_inicio = tarea * filas_por_tarea;
+       int filas_tarea = (fila_inicio + filas_por_tarea <= n) ? filas_por_tarea : n - fila_inicio;
+
+       MPI_Get(A_local, filas_tarea, fila, 0, (MPI_Aint)fila_inicio * n,
+               filas_tarea, fila, ventana_A);
+       MPI_Win_flush(0, ventana_A);
+
+
+       multiplicar_bloque_filas(A_local, B_local, C_local, (size_t)filas_tarea, (size_t)n, (size_t)n);
+
+
+       // C_local se reutiliza en la siguiente tarea: completar el Put antes
+       MPI_Put(C_local, filas_tarea, fila, 0, (MPI_Aint)fila_inicio * n,
+               filas_tarea, fila, ventana_C);
+       MPI_Win_flush(0, ventana_C);
    }
 
+   MPI_Win_unlock(0, ventana_C);
+   MPI_Win_unlock(0, ventana_A);
+   MPI_Win_unlock(0, ventana_contador);
 
-   // Reducir resultados al proceso 0
-   MPI_Reduce(C_local, C, n * n, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+
+   // MPI_Win_free es colectiva: al volver, todos los Put sobre C son visibles en el raíz
+   MPI_Win_free(&ventana_contador);
+   MPI_Win_free(&ventana_C);
+   MPI_Win_free(&ventana_B);
+   MPI_Win_free(&ventana_A);
+   liberar_tipo_fila(&fila);
 
 
    free(A_local);
@@ -279,6 +302,125 @@ void multiplicar_matrices_mpi_broadcast(const double* A, const double* B, double
 }
 
 
+// ============================================================================
+// IMPLEMENTACIÓN ANILLO - Algoritmo sistólico 1D con memoria O(n²/p)
+// ============================================================================
+/**
+ * Cada proceso recibe un bloque de filas de A y el bloque de filas de B con
+ * los mismos índices (ambos mediante MPI_Scatterv). Los bloques de B
+ * recorren un anillo en p pasos: en el paso s el proceso r tiene el bloque
+ * (r + s) mod p de B y acumula C_r += A_r[:, bloque] * B_bloque.
+ *
+ * El desplazamiento usa doble buffer con MPI_Isend/MPI_Irecv hacia el
+ * vecino, de modo que la transferencia del siguiente bloque se solapa con
+ * la multiplicación local del actual. Ningún proceso guarda B completa.
+ *
+ * Nota: el orden de las sumas depende del rango, así que el resultado puede
+ * diferir del secuencial en el último bit; se verifica con error relativo.
+ */
+void multiplicar_matrices_mpi_anillo(const double* A, const double* B, double* C, int n) {
+   int rango, tamano;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+   MPI_Comm_size(MPI_COMM_WORLD, &tamano);
+
+
+   // Todos los procesos necesitan la distribución completa para conocer
+   // el tamaño de los bloques de B que reciben por el anillo
+   int filas_base = n / tamano;
+   int filas_extra = n % tamano;
+   int filas_local = filas_base + (rango < filas_extra ? 1 : 0);
+   int filas_max = filas_base + (filas_extra > 0 ? 1 : 0);
+
+   // Conteos y desplazamientos en filas: siempre caben en int
+   int* filas_proceso = (int*)malloc(tamano * sizeof(int));
+   int* desplazamientos = (int*)malloc(tamano * sizeof(int));
+
+   // Al menos un elemento para que los procesos sin filas tengan buffers válidos
+   size_t elementos_local = (filas_local > 0) ? (size_t)filas_local * n : 1;
+   size_t elementos_max = (filas_max > 0) ? (size_t)filas_max * n : 1;
+   double* A_local = (double*)malloc(elementos_local * sizeof(double));
+   double* C_local = (double*)calloc(elementos_local, sizeof(double));
+   double* B_bloques[2];
+   B_bloques[0] = (double*)malloc(elementos_max * sizeof(double));
+   B_bloques[1] = (double*)malloc(elementos_max * sizeof(double));
+
+   if (!filas_proceso || !desplazamientos || !A_local || !C_local || !B_bloques[0] || !B_bloques[1]) {
+       fprintf(stderr, "Proceso %d: Error en asignación de memoria\n", rango);
+       MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+       return;
+   }
+
+
+   int offset = 0;
+   for (int i = 0; i < tamano; i++) {
+       filas_proceso[i] = filas_base + (i < filas_extra ? 1 : 0);
+       desplazamientos[i] = offset;
+       offset += filas_proceso[i];
+   }
+
+
+   // A y B se reparten con la misma distribución por filas
+   scatterv_filas(A, filas_proceso, desplazamientos, A_local, n, 0);
+   scatterv_filas(B, filas_proceso, desplazamientos, B_bloques[0], n, 0);
+
+
+   MPI_Datatype fila = crear_tipo_fila(n);
+   int destino = (rango - 1 + tamano) % tamano;
+   int origen = (rango + 1) % tamano;
+   int actual = 0;
+
+   for (int paso = 0; paso < tamano; paso++) {
+       int bloque = (rango + paso) % tamano;
+       bool hay_siguiente = (paso < tamano - 1);
+       MPI_Request solicitudes[2];
+
+
+       // Iniciar el desplazamiento del bloque antes de calcular con él
+       if (hay_siguiente) {
+           int bloque_siguiente = (bloque + 1) % tamano;
+           MPI_Irecv(B_bloques[1 - actual], filas_proceso[bloque_siguiente], fila,
+                     origen, paso, MPI_COMM_WORLD, &solicitudes[0]);
+           MPI_Isend(B_bloques[actual], filas_proceso[bloque], fila,
+                     destino, paso, MPI_COMM_WORLD, &solicitudes[1]);
+       }
+
+
+       // C_local += A_local[:, k_inicio:k_inicio+k_filas] * B_bloque
+       size_t k_inicio = (size_t)desplazamientos[bloque];
+       size_t k_filas = (size_t)filas_proceso[bloque];
+       const double* B_bloque = B_bloques[actual];
+
+       for (size_t i_local = 0; i_local < (size_t)filas_local; i_local++) {
+           for (size_t k = 0; k < k_filas; k++) {
+               double a = A_local[i_local * n + k_inicio + k];
+               for (size_t j = 0; j < (size_t)n; j++) {
+                   C_local[i_local * n + j] += a * B_bloque[k * n + j];
+               }
+           }
+       }
+
+
+       if (hay_siguiente) {
+           MPI_Waitall(2, solicitudes, MPI_STATUSES_IGNORE);
+           actual = 1 - actual;
+       }
+   }
+   liberar_tipo_fila(&fila);
+
+
+   // Recopilar resultados con Gatherv
+   gatherv_filas(C_local, C, filas_proceso, desplazamientos, n, 0);
+
+
+   free(A_local);
+   free(C_local);
+   free(B_bloques[0]);
+   free(B_bloques[1]);
+   free(filas_proceso);
+   free(desplazamientos);
+}
+
+
 // ============================================================================
 // FUNCIONES AUXILIARES
 // ============================================================================
@@ -288,16 +430,22 @@ void multiplicar_matrices_mpi_broadcast(const double* A, const double* B, double
  * La medición se sincroniza mediante barreras antes y después de ejecutar
  * la función de multiplicación para asegurar que todos los procesos midan
  * el mismo intervalo de tiempo.
+ *
+ * Se llama a estrategia; si es NULL, a estrategia_formato con el formato de
+ * transporte y las estadísticas dados (estas pueden ser NULL).
  */
-
-
 double medir_tiempo_mpi_paralelo(const double* A, const double* B, double* C, int n,
-                               void (*funcion_multiplicacion)(const double*, const double*, double*, int)) {
+                                 FuncionMultiplicacion estrategia, FuncionMultiplicacionFormato estrategia_formato,
+                                 FormatoTransporte formato, EstadisticasTransporte* estadisticas) {
    MPI_Barrier(MPI_COMM_WORLD);
    double inicio = MPI_Wtime();
 
 
-   funcion_multiplicacion(A, B, C, n);
+   if (estrategia) {
+       estrategia(A, B, C, n);
+   } else {
+       estrategia_formato(A, B, C, n, formato, estadisticas);
+   }
 
 
    MPI_Barrier(MPI_COMM_WORLD);
@@ -309,6 +457,8 @@ double medir_tiempo_mpi_paralelo(const double* A, const double* B, double* C, in
  *   - Versión secuencial
  *   - Versión MPI Scatter/Gather
  *   - Versión MPI Broadcast
+ *   - Versión MPI RMA
+ *   - Versión MPI Anillo
  *
  * Para un tamaño n de matriz, esta función:
  *   1. Genera matrices aleatorias A y B.
@@ -330,10 +480,12 @@ bool comparar_rendimiento_mpi(int n) {
        double* B = crear_matriz(n);
        double* C_scatter = crear_matriz(n);
        double* C_bcast = crear_matriz(n);
+       double* C_rma = crear_matriz(n);
+       double* C_anillo = crear_matriz(n);
        double* C_secuencial = crear_matriz(n);
 
 
-       if (!A || !B || !C_scatter || !C_bcast || !C_secuencial) {
+       if (!A || !B || !C_scatter || !C_bcast || !C_rma || !C_anillo || !C_secuencial) {
            fprintf(stderr, "Error: No se pudieron crear matrices para prueba\n");
            return false;
        }
@@ -343,14 +495,24 @@ bool comparar_rendimiento_mpi(int n) {
        llenar_matriz(B, n);
 
 
-       // Medir tiempos
-       double tiempo_secuencial = medir_tiempo_mpi_paralelo(A, B, C_secuencial, n, multiplicar_matrices_secuencial);
-       double tiempo_scatter = medir_tiempo_mpi_paralelo(A, B, C_scatter, n, multiplicar_matrices_mpi_scatter);
-       double tiempo_bcast = medir_tiempo_mpi_paralelo(A, B, C_bcast, n, multiplicar_matrices_mpi_broadcast);
+       // Medir tiempos (la versión secuencial solo corre en el raíz: sin barreras)
+       double inicio_secuencial = MPI_Wtime();
+       multiplicar_matrices_secuencial(A, B, C_secuencial, n);
+       double tiempo_secuencial = MPI_Wtime() - inicio_secuencial;
+       double tiempo_scatter = medir_tiempo_mpi_paralelo(A, B, C_scatter, n, multiplicar_matrices_mpi_scatter, NULL,
+                                                         TRANSPORTE_FP64, NULL);
+       double tiempo_bcast = medir_tiempo_mpi_paralelo(A, B, C_bcast, n, multiplicar_matrices_mpi_broadcast, NULL,
+                                                       TRANSPORTE_FP64, NULL);
+       double tiempo_rma = medir_tiempo_mpi_paralelo(A, B, C_rma, n, multiplicar_matrices_mpi_rma, NULL,
+                                                     TRANSPORTE_FP64, NULL);
+       double tiempo_anillo = medir_tiempo_mpi_paralelo(A, B, C_anillo, n, multiplicar_matrices_mpi_anillo, NULL,
+                                                        TRANSPORTE_FP64, NULL);
 
 
        bool scatter_correcto = verificar_correccion_matriz(C_secuencial, C_scatter, n, TOLERANCIA_VERIFICACION);
        bool bcast_correcto = verificar_correccion_matriz(C_secuencial, C_bcast, n, TOLERANCIA_VERIFICACION);
+       bool rma_correcto = verificar_correccion_matriz(C_secuencial, C_rma, n, TOLERANCIA_VERIFICACION);
+       bool anillo_correcto = calcular_error_relativo(C_secuencial, C_anillo, n) <= TOLERANCIA_RELATIVA_MPI;
 
 
        // Mostrar resultados
@@ -359,6 +521,10 @@ bool comparar_rendimiento_mpi(int n) {
               scatter_correcto ? "✓" : "✗");
        printf("MPI Broadcast: %.6f segundos %s\n", tiempo_bcast,
               bcast_correcto ? "✓" : "✗");
+       printf("MPI RMA:       %.6f segundos %s\n", tiempo_rma,
+              rma_correcto ? "✓" : "✗");
+       printf("MPI Anillo:    %.6f segundos %s\n", tiempo_anillo,
+              anillo_correcto ? "✓" : "✗");
 
 
        // Calcular speedup
@@ -370,6 +536,14 @@ bool comparar_rendimiento_mpi(int n) {
            double speedup_bcast = tiempo_secuencial / tiempo_bcast;
            printf("Speedup Broadcast: %.2fx\n", speedup_bcast);
        }
+       if (tiempo_rma > 0 && tiempo_secuencial > 0) {
+           double speedup_rma = tiempo_secuencial / tiempo_rma;
+           printf("Speedup RMA: %.2fx\n", speedup_rma);
+       }
+       if (tiempo_anillo > 0 && tiempo_secuencial > 0) {
+           double speedup_anillo = tiempo_secuencial / tiempo_anillo;
+           printf("Speedup Anillo: %.2fx\n", speedup_anillo);
+       }
 
 
        // Limpiar
@@ -377,19 +551,28 @@ bool comparar_rendimiento_mpi(int n) {
        liberar_matriz(B);
        liberar_matriz(C_scatter);
        liberar_matriz(C_bcast);
+       liberar_matriz(C_rma);
+       liberar_matriz(C_anillo);
        liberar_matriz(C_secuencial);
 
 
-       return scatter_correcto && bcast_correcto;
+       return scatter_correcto && bcast_correcto && rma_correcto && anillo_correcto;
    } else {
        // 🟡 CORREGIDO: Otros procesos participan sin crear matrices grandes
        // Usar matrices de tamaño 1 para evitar segmentation faults
        double A_dummy[1], B_dummy[1], C_dummy[1];
 
 
-       // Participar en las mediciones con datos dummy
-       multiplicar_matrices_mpi_scatter((const double*)A_dummy, (const double*)B_dummy, C_dummy, n);
-       multiplicar_matrices_mpi_broadcast((const double*)A_dummy, (const double*)B_dummy, C_dummy, n);
+       // Participar en las mediciones con datos dummy, con las mismas
+       // barreras que el raíz para que las colectivas queden emparejadas
+       medir_tiempo_mpi_paralelo(A_dummy, B_dummy, C_dummy, n, multiplicar_matrices_mpi_scatter, NULL,
+                                 TRANSPORTE_FP64, NULL);
+       medir_tiempo_mpi_paralelo(A_dummy, B_dummy, C_dummy, n, multiplicar_matrices_mpi_broadcast, NULL,
+                                 TRANSPORTE_FP64, NULL);
+       medir_tiempo_mpi_paralelo(A_dummy, B_dummy, C_dummy, n, multiplicar_matrices_mpi_rma, NULL,
+                                 TRANSPORTE_FP64, NULL);
+       medir_tiempo_mpi_paralelo(A_dummy, B_dummy, C_dummy, n, multiplicar_matrices_mpi_anillo, NULL,
+                                 TRANSPORTE_FP64, NULL);
 
 
        return true;
@@ -3,12 +3,16 @@
 
 
 #include <stdbool.h>
+#include "matrix_ops.h"
+#include "transporte_reducido.h"
 
 
 // ============================================================================
 // CONFIGURACIÓN
 // ============================================================================
-#define TOLERANCIA_VERIFICACION_MPI 1e-9
+#define TOLERANCIA_VERIFICACION_MPI TOLERANCIA_VERIFICACION
+#define TOLERANCIA_RELATIVA_MPI 1e-12
+#define TAREAS_POR_PROCESO_RMA 4
 
 
 // ============================================================================
@@ -16,8 +20,19 @@
 // ============================================================================
 
 
+typedef void (*FuncionMultiplicacion)(const double* A, const double* B, double* C, int n);
+typedef void (*FuncionMultiplicacionFormato)(const double* A, const double* B, double* C, int n,
+                                             FormatoTransporte formato, EstadisticasTransporte* estadisticas);
+
+
 void multiplicar_matrices_mpi_scatter(const double* A, const double* B, double* C, int n);
 void multiplicar_matrices_mpi_broadcast(const double* A, const double* B, double* C, int n);
+void multiplicar_matrices_mpi_scatter_formato(const double* A, const double* B, double* C, int n,
+                                             FormatoTransporte formato, EstadisticasTransporte* estadisticas);
+void multiplicar_matrices_mpi_broadcast_formato(const double* A, const double* B, double* C, int n,
+                                               FormatoTransporte formato, EstadisticasTransporte* estadisticas);
+void multiplicar_matrices_mpi_rma(const double* A, const double* B, double* C, int n);
+void multiplicar_matrices_mpi_anillo(const double* A, const double* B, double* C, int n);
 
 
 // ============================================================================
@@ -25,6 +40,9 @@ void multiplicar_matrices_mpi_broadcast(const double* A, const double* B, double
 // ============================================================================
 
 
+double medir_tiempo_mpi_paralelo(const double* A, const double* B, double* C, int n,
+                                 FuncionMultiplicacion estrategia, FuncionMultiplicacionFormato estrategia_formato,
+                                 FormatoTransporte formato, EstadisticasTransporte* estadisticas);
 bool comparar_rendimiento_mpi(int n);
 void ejecutar_pruebas_rendimiento(void);
 
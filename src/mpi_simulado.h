@@ -0,0 +1,436 @@
+#ifndef MPI_SIMULADO_H
+#define MPI_SIMULADO_H
+
+
+// ============================================================================
+// MPI REAL O SIMULADO
+// ============================================================================
+
+/*
+ * En Linux se usa la biblioteca MPI real. En otros sistemas (compilación con
+ * un compilador de C normal, sin mpicc) se simula un único proceso: rango 0,
+ * tamaño 1, las colectivas copian del buffer de envío al de recepción y las
+ * ventanas RMA y los archivos MPI-IO acceden directamente a la memoria y a
+ * stdio. Solo se simula lo que usa el proyecto.
+ *
+ * En la simulación un MPI_Datatype es su tamaño en bytes, así que los tipos
+ * derivados contiguos son simplemente múltiplos del tipo base.
+ */
+#ifdef __linux__
+#define TIENE_MPI_REAL 1
+#include <mpi.h>
+#else
+#define TIENE_MPI_REAL 0
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+#define MPI_VERSION 3  // Sin colectivas de conteo grande: mpi_grande parte en trozos
+#define MPI_SUCCESS 0
+#define MPI_ERR_RANK 6
+#define MPI_UNDEFINED (-32766)
+
+
+typedef int MPI_Comm;
+#define MPI_COMM_NULL (-1)
+#define MPI_COMM_WORLD 0
+#define MPI_COMM_SELF 1
+
+
+typedef int MPI_Datatype;
+#define MPI_DATATYPE_NULL 0
+#define MPI_CHAR ((MPI_Datatype)sizeof(char))
+#define MPI_BYTE ((MPI_Datatype)1)
+#define MPI_C_BOOL ((MPI_Datatype)sizeof(bool))
+#define MPI_INT ((MPI_Datatype)sizeof(int))
+#define MPI_FLOAT ((MPI_Datatype)sizeof(float))
+#define MPI_DOUBLE ((MPI_Datatype)sizeof(double))
+#define MPI_UINT16_T ((MPI_Datatype)sizeof(uint16_t))
+#define MPI_UINT64_T ((MPI_Datatype)sizeof(uint64_t))
+
+
+typedef int MPI_Op;
+typedef void MPI_User_function(void* entrada, void* entrada_salida, int* cuenta, MPI_Datatype* tipo);
+#define MPI_OP_NULL 0
+#define MPI_SUM 1
+#define MPI_MAX 2
+#define MPI_MIN 3
+#define MPI_OP_USUARIO 4
+
+
+typedef int MPI_Request;  // Bytes transferidos por la operación ya completada
+typedef int MPI_Status;   // Bytes transferidos (para MPI_Get_count)
+typedef int MPI_Info;
+typedef ptrdiff_t MPI_Aint;
+typedef long long MPI_Offset;
+#define MPI_REQUEST_NULL 0
+#define MPI_STATUS_IGNORE ((MPI_Status*)NULL)
+#define MPI_STATUSES_IGNORE ((MPI_Status*)NULL)
+#define MPI_INFO_NULL 0
+
+
+// Entorno y comunicadores
+static inline int MPI_Init(int* argc, char*** argv) {
+   (void)argc;
+   (void)argv;
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Finalize(void) { return MPI_SUCCESS; }
+
+static inline int MPI_Abort(MPI_Comm comm, int codigo) {
+   (void)comm;
+   exit(codigo);
+   return MPI_SUCCESS;
+}
+
+// Tiempo de reloj, no clock(): clock() suma la CPU de todos los hilos y
+// haría que el motor de hilos no mostrara speedup
+static inline double MPI_Wtime(void) {
+   struct timespec t;
+   timespec_get(&t, TIME_UTC);
+   return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+}
+
+static inline int MPI_Comm_rank(MPI_Comm comm, int* rango) {
+   (void)comm;
+   *rango = 0;
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Comm_size(MPI_Comm comm, int* tamano) {
+   (void)comm;
+   *tamano = 1;
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Comm_split(MPI_Comm comm, int color, int clave, MPI_Comm* nuevo) {
+   (void)clave;
+   *nuevo = (color == MPI_UNDEFINED) ? MPI_COMM_NULL : comm;
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Comm_free(MPI_Comm* comm) {
+   *comm = MPI_COMM_NULL;
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Barrier(MPI_Comm comm) {
+   (void)comm;
+   return MPI_SUCCESS;
+}
+
+
+// Tipos derivados y operaciones de usuario
+static inline int MPI_Type_contiguous(int cuenta, MPI_Datatype tipo, MPI_Datatype* nuevo) {
+   *nuevo = cuenta * tipo;
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Type_commit(MPI_Datatype* tipo) {
+   (void)tipo;
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Type_free(MPI_Datatype* tipo) {
+   *tipo = MPI_DATATYPE_NULL;
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Op_create(MPI_User_function* funcion, int conmutativa, MPI_Op* op) {
+   (void)funcion;
+   (void)conmutativa;
+   *op = MPI_OP_USUARIO;
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Op_free(MPI_Op* op) {
+   *op = MPI_OP_NULL;
+   return MPI_SUCCESS;
+}
+
+
+// Colectivas: con un solo proceso, el raíz se envía a sí mismo
+static inline int mpi_simulado_copiar(const void* envio, void* recepcion, size_t bytes) {
+   if (envio && recepcion && envio != recepcion && bytes > 0) {
+       memmove(recepcion, envio, bytes);
+   }
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Bcast(void* buffer, int cuenta, MPI_Datatype tipo, int raiz, MPI_Comm comm) {
+   (void)buffer;
+   (void)cuenta;
+   (void)tipo;
+   (void)raiz;
+   (void)comm;
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Ibcast(void* buffer, int cuenta, MPI_Datatype tipo, int raiz, MPI_Comm comm,
+                             MPI_Request* solicitud) {
+   *solicitud = MPI_REQUEST_NULL;
+   return MPI_Bcast(buffer, cuenta, tipo, raiz, comm);
+}
+
+static inline int MPI_Reduce(const void* envio, void* recepcion, int cuenta, MPI_Datatype tipo,
+                             MPI_Op op, int raiz, MPI_Comm comm) {
+   (void)op;
+   (void)raiz;
+   (void)comm;
+   return mpi_simulado_copiar(envio, recepcion, (size_t)cuenta * tipo);
+}
+
+static inline int MPI_Allreduce(const void* envio, void* recepcion, int cuenta, MPI_Datatype tipo,
+                                MPI_Op op, MPI_Comm comm) {
+   return MPI_Reduce(envio, recepcion, cuenta, tipo, op, 0, comm);
+}
+
+static inline int MPI_Scatter(const void* envio, int cuenta_envio, MPI_Datatype tipo_envio,
+                              void* recepcion, int cuenta, MPI_Datatype tipo, int raiz, MPI_Comm comm) {
+   (void)cuenta_envio;
+   (void)tipo_envio;
+   (void)raiz;
+   (void)comm;
+   return mpi_simulado_copiar(envio, recepcion, (size_t)cuenta * tipo);
+}
+
+static inline int MPI_Gather(const void* envio, int cuenta, MPI_Datatype tipo,
+                             void* recepcion, int cuenta_recepcion, MPI_Datatype tipo_recepcion,
+                             int raiz, MPI_Comm comm) {
+   (void)cuenta_recepcion;
+   (void)tipo_recepcion;
+   (void)raiz;
+   (void)comm;
+   return mpi_simulado_copiar(envio, recepcion, (size_t)cuenta * tipo);
+}
+
+static inline int MPI_Scatterv(const void* envio, const int* cuentas, const int* desplazamientos,
+                               MPI_Datatype tipo_envio, void* recepcion, int cuenta,
+                               MPI_Datatype tipo, int raiz, MPI_Comm comm) {
+   (void)cuentas;
+   (void)raiz;
+   (void)comm;
+   if (!envio) return MPI_SUCCESS;
+   return mpi_simulado_copiar((const char*)envio + (size_t)desplazamientos[0] * tipo_envio,
+                              recepcion, (size_t)cuenta * tipo);
+}
+
+static inline int MPI_Gatherv(const void* envio, int cuenta, MPI_Datatype tipo,
+                              void* recepcion, const int* cuentas, const int* desplazamientos,
+                              MPI_Datatype tipo_recepcion, int raiz, MPI_Comm comm) {
+   (void)cuentas;
+   (void)raiz;
+   (void)comm;
+   if (!recepcion) return MPI_SUCCESS;
+   return mpi_simulado_copiar(envio, (char*)recepcion + (size_t)desplazamientos[0] * tipo_recepcion,
+                              (size_t)cuenta * tipo);
+}
+
+static inline int MPI_Allgatherv(const void* envio, int cuenta, MPI_Datatype tipo,
+                                 void* recepcion, const int* cuentas, const int* desplazamientos,
+                                 MPI_Datatype tipo_recepcion, MPI_Comm comm) {
+   return MPI_Gatherv(envio, cuenta, tipo, recepcion, cuentas, desplazamientos, tipo_recepcion, 0, comm);
+}
+
+
+// Punto a punto: con un solo proceso no hay otro rango con quien comunicarse
+static inline int MPI_Send(const void* buffer, int cuenta, MPI_Datatype tipo, int destino, int etiqueta,
+                           MPI_Comm comm) {
+   (void)buffer;
+   (void)cuenta;
+   (void)tipo;
+   (void)destino;
+   (void)etiqueta;
+   (void)comm;
+   return MPI_ERR_RANK;
+}
+
+static inline int MPI_Recv(void* buffer, int cuenta, MPI_Datatype tipo, int origen, int etiqueta,
+                           MPI_Comm comm, MPI_Status* estado) {
+   (void)estado;
+   return MPI_Send(buffer, cuenta, tipo, origen, etiqueta, comm);
+}
+
+static inline int MPI_Isend(const void* buffer, int cuenta, MPI_Datatype tipo, int destino, int etiqueta,
+                            MPI_Comm comm, MPI_Request* solicitud) {
+   *solicitud = MPI_REQUEST_NULL;
+   return MPI_Send(buffer, cuenta, tipo, destino, etiqueta, comm);
+}
+
+static inline int MPI_Irecv(void* buffer, int cuenta, MPI_Datatype tipo, int origen, int etiqueta,
+                            MPI_Comm comm, MPI_Request* solicitud) {
+   *solicitud = MPI_REQUEST_NULL;
+   return MPI_Send(buffer, cuenta, tipo, origen, etiqueta, comm);
+}
+
+// Las operaciones no bloqueantes simuladas se completan al iniciarse; la
+// solicitud solo guarda los bytes transferidos para el estado
+static inline int MPI_Wait(MPI_Request* solicitud, MPI_Status* estado) {
+   if (estado) *estado = *solicitud;
+   *solicitud = MPI_REQUEST_NULL;
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Waitall(int cuenta, MPI_Request* solicitudes, MPI_Status* estados) {
+   for (int i = 0; i < cuenta; i++) MPI_Wait(&solicitudes[i], estados ? &estados[i] : NULL);
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Get_count(const MPI_Status* estado, MPI_Datatype tipo, int* cuenta) {
+   *cuenta = (tipo > 0 && *estado % tipo == 0) ? *estado / tipo : MPI_UNDEFINED;
+   return MPI_SUCCESS;
+}
+
+
+// Ventanas RMA: el único proceso accede directamente a la memoria expuesta
+typedef struct {
+   char* base;
+   int unidad;
+} VentanaSimulada;
+
+typedef VentanaSimulada* MPI_Win;
+#define MPI_WIN_NULL ((MPI_Win)NULL)
+#define MPI_LOCK_SHARED 2
+#define MPI_LOCK_EXCLUSIVE 1
+
+static inline int MPI_Win_create(void* base, MPI_Aint bytes, int unidad, MPI_Info info, MPI_Comm comm,
+                                 MPI_Win* ventana) {
+   (void)bytes;
+   (void)info;
+   (void)comm;
+   *ventana = (MPI_Win)malloc(sizeof(VentanaSimulada));
+   if (!*ventana) return MPI_ERR_RANK;
+   (*ventana)->base = (char*)base;
+   (*ventana)->unidad = unidad;
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Win_free(MPI_Win* ventana) {
+   free(*ventana);
+   *ventana = MPI_WIN_NULL;
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Get(void* origen, int cuenta, MPI_Datatype tipo, int rango_objetivo,
+                          MPI_Aint desplazamiento, int cuenta_objetivo, MPI_Datatype tipo_objetivo, MPI_Win ventana) {
+   (void)rango_objetivo;
+   (void)cuenta_objetivo;
+   (void)tipo_objetivo;
+   return mpi_simulado_copiar(ventana->base + desplazamiento * ventana->unidad, origen, (size_t)cuenta * tipo);
+}
+
+static inline int MPI_Put(const void* origen, int cuenta, MPI_Datatype tipo, int rango_objetivo,
+                          MPI_Aint desplazamiento, int cuenta_objetivo, MPI_Datatype tipo_objetivo, MPI_Win ventana) {
+   (void)rango_objetivo;
+   (void)cuenta_objetivo;
+   (void)tipo_objetivo;
+   return mpi_simulado_copiar(origen, ventana->base + desplazamiento * ventana->unidad, (size_t)cuenta * tipo);
+}
+
+// Solo se simula MPI_SUM sobre MPI_INT, el contador de tareas de la estrategia RMA
+static inline int MPI_Fetch_and_op(const void* origen, void* resultado, MPI_Datatype tipo, int rango_objetivo,
+                                   MPI_Aint desplazamiento, MPI_Op op, MPI_Win ventana) {
+   (void)tipo;
+   (void)rango_objetivo;
+   int* objetivo = (int*)(ventana->base + desplazamiento * ventana->unidad);
+   *(int*)resultado = *objetivo;
+   if (op == MPI_SUM) *objetivo += *(const int*)origen;
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Win_lock(int tipo, int rango, int asercion, MPI_Win ventana) {
+   (void)tipo;
+   (void)rango;
+   (void)asercion;
+   (void)ventana;
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Win_unlock(int rango, MPI_Win ventana) {
+   (void)rango;
+   (void)ventana;
+   return MPI_SUCCESS;
+}
+
+static inline int MPI_Win_flush(int rango, MPI_Win ventana) {
+   return MPI_Win_unlock(rango, ventana);
+}
+
+
+// MPI-IO sobre stdio. Al crear un archivo se trunca: el único proceso es
+// también el único que lo escribe, y MPI_File_set_size fija después su tamaño.
+typedef FILE* MPI_File;
+#define MPI_MODE_RDONLY 2
+#define MPI_MODE_WRONLY 4
+#define MPI_MODE_CREATE 1
+
+static inline int MPI_File_open(MPI_Comm comm, const char* ruta, int modo, MPI_Info info, MPI_File* archivo) {
+   (void)comm;
+   (void)info;
+   if (modo & MPI_MODE_RDONLY) {
+       *archivo = fopen(ruta, "rb");
+   } else {
+       *archivo = fopen(ruta, (modo & MPI_MODE_CREATE) ? "w+b" : "r+b");
+   }
+   return *archivo ? MPI_SUCCESS : MPI_ERR_RANK;
+}
+
+static inline int MPI_File_close(MPI_File* archivo) {
+   fclose(*archivo);
+   *archivo = NULL;
+   return MPI_SUCCESS;
+}
+
+// Como en MPI-IO, leer más allá del final no es un error: el estado
+// informa los bytes realmente transferidos
+static inline int MPI_File_read_at(MPI_File archivo, MPI_Offset posicion, void* buffer, int cuenta,
+                                   MPI_Datatype tipo, MPI_Status* estado) {
+   size_t bytes = (size_t)cuenta * tipo;
+   if (fseek(archivo, (long)posicion, SEEK_SET) != 0) return MPI_ERR_RANK;
+   size_t leidos = fread(buffer, 1, bytes, archivo);
+   if (estado) *estado = (int)leidos;
+   return ferror(archivo) ? MPI_ERR_RANK : MPI_SUCCESS;
+}
+
+static inline int MPI_File_write_at(MPI_File archivo, MPI_Offset posicion, const void* buffer, int cuenta,
+                                    MPI_Datatype tipo, MPI_Status* estado) {
+   size_t bytes = (size_t)cuenta * tipo;
+   if (fseek(archivo, (long)posicion, SEEK_SET) != 0) return MPI_ERR_RANK;
+   size_t escritos = fwrite(buffer, 1, bytes, archivo);
+   if (estado) *estado = (int)escritos;
+   return escritos == bytes ? MPI_SUCCESS : MPI_ERR_RANK;
+}
+
+static inline int MPI_File_get_size(MPI_File archivo, MPI_Offset* tamano) {
+   if (fseek(archivo, 0, SEEK_END) != 0) return MPI_ERR_RANK;
+   *tamano = ftell(archivo);
+   return *tamano < 0 ? MPI_ERR_RANK : MPI_SUCCESS;
+}
+
+// Sin truncado portable en stdio: solo se extiende el archivo hasta el tamaño
+static inline int MPI_File_set_size(MPI_File archivo, MPI_Offset tamano) {
+   if (tamano <= 0) return MPI_SUCCESS;
+   char cero = 0;
+   return MPI_File_write_at(archivo, tamano - 1, &cero, 1, MPI_BYTE, MPI_STATUS_IGNORE);
+}
+
+static inline int MPI_File_iread_at(MPI_File archivo, MPI_Offset posicion, void* buffer, int cuenta,
+                                    MPI_Datatype tipo, MPI_Request* solicitud) {
+   return MPI_File_read_at(archivo, posicion, buffer, cuenta, tipo, solicitud);
+}
+
+static inline int MPI_File_iwrite_at(MPI_File archivo, MPI_Offset posicion, const void* buffer, int cuenta,
+                                     MPI_Datatype tipo, MPI_Request* solicitud) {
+   return MPI_File_write_at(archivo, posicion, buffer, cuenta, tipo, solicitud);
+}
+#endif
+
+
+#endif
@@ -0,0 +1,487 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mpi_simulado.h"
+#include "matrix_ops.h"
+#include "mpi_ops.h"
+#include "mpi_grande.h"
+#include "producto_simetrico.h"
+
+
+// ============================================================================
+// TESELAS DEL TRIÁNGULO INFERIOR
+// ============================================================================
+
+/*
+ * Las teselas (bi, bj) con bj <= bi se recorren por filas de teselas. Dentro
+ * de cada tesela los elementos j <= i se guardan por filas; ese mismo orden
+ * es el del flujo empaquetado que se recolecta en el raíz.
+ */
+
+size_t elementos_triangulares(int n) {
+   return (size_t)n * ((size_t)n + 1) / 2;
+}
+
+
+/**
+ * Lado de tesela: TAMANO_TESELA_SIMETRICA, reducido si hace falta para que
+ * cada proceso reciba al menos TESELAS_POR_PROCESO_SIMETRICA teselas y el
+ * reparto pueda equilibrarse con matrices pequeñas.
+ */
+static int calcular_lado_tesela(int n, int tamano) {
+   int lado = TAMANO_TESELA_SIMETRICA;
+   while (lado > 1) {
+       size_t bloques = (size_t)((n + lado - 1) / lado);
+       if (bloques * (bloques + 1) / 2 >= (size_t)TESELAS_POR_PROCESO_SIMETRICA * tamano) break;
+       lado--;
+   }
+   return lado;
+}
+
+
+static int filas_tesela(int bloque, int n, int lado) {
+   int inicio = bloque * lado;
+   return (n - inicio < lado) ? n - inicio : lado;
+}
+
+
+/**
+ * Elementos del triángulo inferior que contiene la tesela (bi, bj): su
+ * tamaño empaquetado y, a la vez, su peso en flops.
+ */
+static size_t peso_tesela(int bi, int bj, int n, int lado) {
+   size_t filas = (size_t)filas_tesela(bi, n, lado);
+   if (bi == bj) return filas * (filas + 1) / 2;
+   return filas * (size_t)filas_tesela(bj, n, lado);
+}
+
+
+/**
+ * Reparte las teselas en tramos contiguos de peso similar. El proceso r
+ * recibe las teselas [limites[r], limites[r+1]) y elementos[r] elementos
+ * empaquetados. El cálculo es determinista, así que todos los procesos lo
+ * hacen por su cuenta sin comunicarse.
+ */
+static void repartir_teselas(int n, int lado, int tamano, int* limites, size_t* elementos) {
+   int bloques = (n + lado - 1) / lado;
+   size_t total = elementos_triangulares(n);
+   size_t acumulado = 0;
+   int proceso = 0;
+   int tesela = 0;
+
+   limites[0] = 0;
+   for (int r = 0; r < tamano; r++) elementos[r] = 0;
+
+   for (int bi = 0; bi < bloques; bi++) {
+       for (int bj = 0; bj <= bi; bj++, tesela++) {
+           // Dueño según el punto medio de la tesela dentro del trabajo total
+           size_t peso = peso_tesela(bi, bj, n, lado);
+           int dueno = (int)(((double)acumulado + 0.5 * peso) * tamano / (double)total);
+           if (dueno >= tamano) dueno = tamano - 1;
+           while (proceso < dueno) {
+               limites[++proceso] = tesela;
+           }
+
+           elementos[proceso] += peso;
+           acumulado += peso;
+       }
+   }
+   while (proceso < tamano) {
+       limites[++proceso] = tesela;
+   }
+}
+
+
+/**
+ * Calcula el triángulo inferior de la tesela (bi, bj) en salida, en orden
+ * empaquetado. Devuelve el número de elementos escritos.
+ *
+ * A·Aᵀ es un producto escalar entre filas de A (acceso contiguo). Aᵀ·A
+ * acumula en orden k externo para recorrer A por filas; en ambos casos cada
+ * elemento suma sus términos en k creciente, el mismo orden que
+ * multiplicar_matrices_secuencial con Aᵀ explícita.
+ */
+static size_t calcular_tesela(const double* A, int n, int lado, int bi, int bj,
+                              ProductoSimetrico producto, double* salida) {
+   size_t i0 = (size_t)bi * lado;
+   size_t j0 = (size_t)bj * lado;
+   size_t filas = (size_t)filas_tesela(bi, n, lado);
+   size_t columnas = (size_t)filas_tesela(bj, n, lado);
+   size_t nn = (size_t)n;
+   bool diagonal = (bi == bj);
+
+   if (producto == PRODUCTO_A_AT) {
+       size_t o = 0;
+       for (size_t r = 0; r < filas; r++) {
+           const double* fila_i = A + (i0 + r) * nn;
+           size_t ancho = diagonal ? r + 1 : columnas;
+           for (size_t c = 0; c < ancho; c++) {
+               const double* fila_j = A + (j0 + c) * nn;
+               double suma = 0.0;
+               for (size_t k = 0; k < nn; k++) {
+                   suma += fila_i[k] * fila_j[k];
+               }
+               salida[o++] = suma;
+           }
+       }
+       return o;
+   }
+
+   size_t elementos = peso_tesela(bi, bj, n, lado);
+   memset(salida, 0, elementos * sizeof(double));
+   for (size_t k = 0; k < nn; k++) {
+       const double* fila_k = A + k * nn;
+       for (size_t r = 0; r < filas; r++) {
+           double a = fila_k[i0 + r];
+           double* destino = salida + (diagonal ? r * (r + 1) / 2 : r * columnas);
+           size_t ancho = diagonal ? r + 1 : columnas;
+           for (size_t c = 0; c < ancho; c++) {
+               destino[c] += a * fila_k[j0 + c];
+           }
+       }
+   }
+   return elementos;
+}
+
+
+/**
+ * Copia una tesela empaquetada a C: en formato empaquetado estándar si
+ * empaquetada es true, o en C completa reflejando el triángulo superior.
+ */
+static size_t colocar_tesela(const double* origen, double* C, int n, int lado, int bi, int bj,
+                             bool empaquetada) {
+   size_t i0 = (size_t)bi * lado;
+   size_t j0 = (size_t)bj * lado;
+   size_t filas = (size_t)filas_tesela(bi, n, lado);
+   size_t columnas = (size_t)filas_tesela(bj, n, lado);
+   size_t nn = (size_t)n;
+   size_t o = 0;
+
+   for (size_t r = 0; r < filas; r++) {
+       size_t i = i0 + r;
+       size_t ancho = (bi == bj) ? r + 1 : columnas;
+       for (size_t c = 0; c < ancho; c++) {
+           size_t j = j0 + c;
+           if (empaquetada) {
+               C[i * (i + 1) / 2 + j] = origen[o++];
+           } else {
+               C[i * nn + j] = origen[o];
+               C[j * nn + i] = origen[o++];
+           }
+       }
+   }
+   return o;
+}
+
+
+/**
+ * Expande un triángulo inferior empaquetado a la matriz simétrica completa.
+ */
+void desempaquetar_triangular(const double* empaquetada, double* C, int n) {
+   size_t nn = (size_t)n;
+   for (size_t i = 0; i < nn; i++) {
+       for (size_t j = 0; j <= i; j++) {
+           double valor = empaquetada[i * (i + 1) / 2 + j];
+           C[i * nn + j] = valor;
+           C[j * nn + i] = valor;
+       }
+   }
+}
+
+
+// ============================================================================
+// VERSIÓN SECUENCIAL
+// ============================================================================
+
+/**
+ * C = A·Aᵀ o C = Aᵀ·A calculando solo el triángulo inferior (n²(n+1) flops
+ * en lugar de 2n³) y reflejándolo.
+ */
+void multiplicar_simetrica_secuencial(const double* A, double* C, int n, ProductoSimetrico producto) {
+   if (!A || !C) return;
+
+   // El triángulo completo es una única tesela diagonal de lado n, cuyo
+   // orden empaquetado coincide con el formato empaquetado estándar
+   double* empaquetada = (double*)malloc(elementos_triangulares(n) * sizeof(double));
+   if (!empaquetada) {
+       fprintf(stderr, "Error en asignación de memoria\n");
+       MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+       return;
+   }
+
+   calcular_tesela(A, n, n, 0, 0, producto, empaquetada);
+   desempaquetar_triangular(empaquetada, C, n);
+   free(empaquetada);
+}
+
+
+// ============================================================================
+// VERSIÓN DISTRIBUIDA
+// ============================================================================
+
+/**
+ * C = A·Aᵀ o C = Aᵀ·A con teselas triangulares equilibradas entre procesos.
+ * A se difunde completa; cada proceso calcula sus teselas en orden
+ * empaquetado y el raíz las recolecta con un único MPI_Gatherv de unas
+ * n(n+1)/2 posiciones, la mitad que el de la multiplicación general.
+ *
+ * Parámetros:
+ *  A          : Matriz A completa (solo relevante en el proceso raíz).
+ *  C          : Salida en el raíz: n*n elementos, o n*(n+1)/2 si empaquetada.
+ *  n          : Dimensión de la matriz cuadrada A.
+ *  producto   : PRODUCTO_A_AT o PRODUCTO_AT_A.
+ *  empaquetada: Solo elige cómo se guarda C en el raíz: si es true, en
+ *               formato triangular empaquetado; si no, completa y
+ *               reflejada. El MPI_Gatherv mueve siempre el flujo
+ *               empaquetado, así que su volumen no depende de este valor.
+ *  bytes_recolectados: Si no es NULL, recibe en el raíz los bytes que movió
+ *                      el MPI_Gatherv de C.
+ */
+void multiplicar_simetrica_mpi(const double* A, double* C, int n, ProductoSimetrico producto, bool empaquetada,
+                               double* bytes_recolectados) {
+   int rango, tamano;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+   MPI_Comm_size(MPI_COMM_WORLD, &tamano);
+
+
+   size_t elementos_matriz = (size_t)n * n;
+   int* limites = (int*)malloc((tamano + 1) * sizeof(int));
+   size_t* elementos_proceso = (size_t*)malloc(tamano * sizeof(size_t));
+   int* filas_proceso = (int*)malloc(tamano * sizeof(int));
+   int* desplazamientos = (int*)malloc(tamano * sizeof(int));
+   double* A_local = (double*)malloc(elementos_matriz * sizeof(double));
+
+   if (!limites || !elementos_proceso || !filas_proceso || !desplazamientos || !A_local) {
+       fprintf(stderr, "Proceso %d: Error en asignación de memoria\n", rango);
+       MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+       return;
+   }
+
+   if (rango == 0) {
+       memcpy(A_local, A, elementos_matriz * sizeof(double));
+   }
+   bcast_grande(A_local, elementos_matriz, 0);
+
+
+   // El flujo empaquetado de cada proceso se rellena hasta un múltiplo de n
+   // para recolectarlo con el tipo "fila" (conteos en filas, sin desbordes)
+   int lado = calcular_lado_tesela(n, tamano);
+   repartir_teselas(n, lado, tamano, limites, elementos_proceso);
+   int offset = 0;
+   for (int i = 0; i < tamano; i++) {
+       filas_proceso[i] = (int)((elementos_proceso[i] + (size_t)n - 1) / (size_t)n);
+       desplazamientos[i] = offset;
+       offset += filas_proceso[i];
+   }
+
+   size_t elementos_local = (size_t)filas_proceso[rango] * n;
+   double* C_local = (double*)malloc((elementos_local > 0 ? elementos_local : 1) * sizeof(double));
+   double* recepcion = NULL;
+   if (rango == 0) {
+       recepcion = (double*)malloc(((size_t)offset * n > 0 ? (size_t)offset * n : 1) * sizeof(double));
+   }
+   if (!C_local || (rango == 0 && !recepcion)) {
+       fprintf(stderr, "Proceso %d: Error en asignación de memoria\n", rango);
+       MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+       return;
+   }
+
+
+   // Cálculo de las teselas propias
+   int bloques = (n + lado - 1) / lado;
+   int tesela = 0;
+   size_t o = 0;
+   for (int bi = 0; bi < bloques; bi++) {
+       for (int bj = 0; bj <= bi; bj++, tesela++) {
+           if (tesela >= limites[rango] && tesela < limites[rango + 1]) {
+               o += calcular_tesela(A_local, n, lado, bi, bj, producto, C_local + o);
+           }
+       }
+   }
+
+
+   gatherv_filas(C_local, recepcion, filas_proceso, desplazamientos, n, 0);
+
+
+   // El raíz recorre las teselas en el mismo orden y las coloca en C
+   if (rango == 0) {
+       if (bytes_recolectados) *bytes_recolectados = (double)offset * n * sizeof(double);
+
+       int proceso = 0;
+       const double* origen = recepcion;
+       tesela = 0;
+       for (int bi = 0; bi < bloques; bi++) {
+           for (int bj = 0; bj <= bi; bj++, tesela++) {
+               while (proceso + 1 < tamano && tesela >= limites[proceso + 1]) {
+                   proceso++;
+                   origen = recepcion + (size_t)desplazamientos[proceso] * n;
+               }
+               origen += colocar_tesela(origen, C, n, lado, bi, bj, empaquetada);
+           }
+       }
+   }
+
+
+   free(A_local);
+   free(C_local);
+   free(recepcion);
+   free(limites);
+   free(elementos_proceso);
+   free(filas_proceso);
+   free(desplazamientos);
+}
+
+
+// ============================================================================
+// PRUEBAS
+// ============================================================================
+
+/**
+ * Máximo / promedio del trabajo por proceso: con teselas equilibradas y con
+ * franjas de filas, donde la fila i del triángulo cuesta i+1 elementos.
+ */
+static void calcular_desequilibrio(int n, int tamano, double* teselas, double* franjas) {
+   int* limites = (int*)malloc((tamano + 1) * sizeof(int));
+   size_t* elementos = (size_t*)malloc(tamano * sizeof(size_t));
+   if (!limites || !elementos) {
+       free(limites);
+       free(elementos);
+       *teselas = *franjas = 0.0;
+       return;
+   }
+
+   double promedio = (double)elementos_triangulares(n) / tamano;
+   repartir_teselas(n, calcular_lado_tesela(n, tamano), tamano, limites, elementos);
+
+   size_t maximo = 0;
+   for (int r = 0; r < tamano; r++) {
+       if (elementos[r] > maximo) maximo = elementos[r];
+   }
+   *teselas = maximo / promedio;
+
+   // Franja del último proceso (la más cara): filas de la cola del triángulo
+   int filas_base = n / tamano;
+   int filas_extra = n % tamano;
+   size_t maximo_franjas = 0;
+   size_t fila = 0;
+   for (int r = 0; r < tamano; r++) {
+       size_t filas = (size_t)(filas_base + (r < filas_extra ? 1 : 0));
+       size_t trabajo = elementos_triangulares((int)(fila + filas)) - elementos_triangulares((int)fila);
+       if (trabajo > maximo_franjas) maximo_franjas = trabajo;
+       fila += filas;
+   }
+   *franjas = maximo_franjas / promedio;
+
+   free(limites);
+   free(elementos);
+}
+
+
+/**
+ * Compara, para A·Aᵀ y Aᵀ·A, la ruta actual (Aᵀ explícita + Scatter) con
+ * la versión simétrica secuencial y distribuida (completa y empaquetada).
+ * Todas se verifican con verificar_correccion_matriz frente a
+ * multiplicar_matrices_secuencial. Todos los procesos deben llamar a esta
+ * función; solo el raíz crea datos y verifica.
+ */
+bool comparar_simetrica_mpi(int n) {
+   int rango, tamano;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+   MPI_Comm_size(MPI_COMM_WORLD, &tamano);
+
+   double* A = NULL;
+   double* At = NULL;
+   double* C_referencia = NULL;
+   double* C_resultado = NULL;
+   double* C_empaquetada = NULL;
+   bool correcto = true;
+
+   if (rango == 0) {
+       printf("\n=== PRODUCTOS SIMÉTRICOS (A·Aᵀ, Aᵀ·A) - Matriz %dx%d ===\n", n, n);
+       A = crear_matriz(n);
+       At = crear_matriz(n);
+       C_referencia = crear_matriz(n);
+       C_resultado = crear_matriz(n);
+       C_empaquetada = (double*)malloc(elementos_triangulares(n) * sizeof(double));
+       if (!A || !At || !C_referencia || !C_resultado || !C_empaquetada) {
+           fprintf(stderr, "Error: No se pudieron crear matrices para prueba\n");
+           MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+       }
+       llenar_matriz(A, n);
+       for (size_t i = 0; i < (size_t)n; i++) {
+           for (size_t j = 0; j < (size_t)n; j++) {
+               At[j * n + i] = A[i * n + j];
+           }
+       }
+
+       double desequilibrio_teselas, desequilibrio_franjas;
+       calcular_desequilibrio(n, tamano, &desequilibrio_teselas, &desequilibrio_franjas);
+       printf("Desequilibrio (máx/prom) con %d procesos: teselas %.2f, franjas de filas %.2f\n",
+              tamano, desequilibrio_teselas, desequilibrio_franjas);
+       printf("%-6s %-22s %12s %16s\n", "", "Variante", "Tiempo (s)", "Gatherv (bytes)");
+   }
+
+   const ProductoSimetrico productos[] = {PRODUCTO_A_AT, PRODUCTO_AT_A};
+   const char* nombres[] = {"A·Aᵀ", "Aᵀ·A"};
+
+   for (int p = 0; p < 2; p++) {
+       ProductoSimetrico producto = productos[p];
+       const double* izquierda = (producto == PRODUCTO_A_AT) ? A : At;
+       const double* derecha = (producto == PRODUCTO_A_AT) ? At : A;
+
+       if (rango == 0) {
+           multiplicar_matrices_secuencial(izquierda, derecha, C_referencia, n);
+       }
+
+       for (int variante = 0; variante < 4; variante++) {
+           const char* nombre_variante = "";
+           double bytes = 0.0;
+
+           MPI_Barrier(MPI_COMM_WORLD);
+           double inicio = MPI_Wtime();
+           switch (variante) {
+               case 0:
+                   nombre_variante = "General (Aᵀ + Scatter)";
+                   multiplicar_matrices_mpi_scatter(izquierda, derecha, C_resultado, n);
+                   bytes = (double)n * n * sizeof(double);
+                   break;
+               case 1:
+                   nombre_variante = "Simétrica secuencial";
+                   if (rango == 0) multiplicar_simetrica_secuencial(A, C_resultado, n, producto);
+                   break;
+               case 2:
+                   nombre_variante = "Simétrica MPI";
+                   multiplicar_simetrica_mpi(A, C_resultado, n, producto, false, &bytes);
+                   break;
+               default:
+                   nombre_variante = "Simétrica MPI empaq.";
+                   multiplicar_simetrica_mpi(A, C_empaquetada, n, producto, true, &bytes);
+                   break;
+           }
+           MPI_Barrier(MPI_COMM_WORLD);
+           double tiempo = MPI_Wtime() - inicio;
+
+           if (rango == 0) {
+               if (variante == 3) desempaquetar_triangular(C_empaquetada, C_resultado, n);
+               bool variante_correcta = verificar_correccion_matriz(C_referencia, C_resultado, n,
+                                                                   TOLERANCIA_VERIFICACION);
+               correcto = correcto && variante_correcta;
+
+               printf("%-6s %-22s %12.6f ", nombres[p], nombre_variante, tiempo);
+               if (bytes > 0.0) printf("%16.0f", bytes);
+               else printf("%16s", "-");
+               printf(" %s\n", variante_correcta ? "✓" : "✗");
+           }
+       }
+   }
+
+   if (rango == 0) {
+       liberar_matriz(A);
+       liberar_matriz(At);
+       liberar_matriz(C_referencia);
+       liberar_matriz(C_resultado);
+       free(C_empaquetada);
+   }
+
+   return correcto;
+}
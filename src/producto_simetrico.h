@@ -0,0 +1,59 @@
+#ifndef PRODUCTO_SIMETRICO_H
+#define PRODUCTO_SIMETRICO_H
+
+
+#include <stdbool.h>
+#include <stddef.h>
+
+
+// ============================================================================
+// CONFIGURACIÓN
+// ============================================================================
+#define TAMANO_TESELA_SIMETRICA 64
+#define TESELAS_POR_PROCESO_SIMETRICA 8
+
+
+// ============================================================================
+// PRODUCTOS SIMÉTRICOS (SYRK) - A·Aᵀ y Aᵀ·A
+// ============================================================================
+
+/*
+ * C = A·Aᵀ o C = Aᵀ·A es simétrica: solo se calcula el triángulo inferior
+ * (la mitad de los flops) y se refleja. Aᵀ nunca se construye.
+ *
+ * La versión distribuida parte el triángulo en teselas de lado
+ * TAMANO_TESELA_SIMETRICA (menor si n es pequeña) y las reparte en tramos
+ * contiguos de igual peso (las teselas diagonales pesan la mitad), en lugar
+ * de franjas de filas, que quedarían desequilibradas con trabajo triangular.
+ *
+ * Formato empaquetado: triángulo inferior por filas, C[i][j] (j <= i) en la
+ * posición i*(i+1)/2 + j, n*(n+1)/2 elementos. La recolección siempre usa
+ * este formato; la opción empaquetada solo decide cómo se entrega C.
+ *
+ * Solo se implementa SYRK (C = A·Aᵀ / Aᵀ·A). SYMM (C = S·B con S
+ * simétrica) queda fuera del alcance: su salida es general, así que no
+ * aprovecha el reparto en teselas triangulares.
+ */
+typedef enum {
+   PRODUCTO_A_AT,  // C = A·Aᵀ
+   PRODUCTO_AT_A   // C = Aᵀ·A
+} ProductoSimetrico;
+
+
+size_t elementos_triangulares(int n);
+void desempaquetar_triangular(const double* empaquetada, double* C, int n);
+
+void multiplicar_simetrica_secuencial(const double* A, double* C, int n, ProductoSimetrico producto);
+void multiplicar_simetrica_mpi(const double* A, double* C, int n, ProductoSimetrico producto, bool empaquetada,
+                               double* bytes_recolectados);
+
+
+// ============================================================================
+// PRUEBAS
+// ============================================================================
+
+
+bool comparar_simetrica_mpi(int n);
+
+
+#endif
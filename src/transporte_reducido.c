@@ -0,0 +1,624 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "mpi_simulado.h"
+#include "matrix_ops.h"
+#include "mpi_grande.h"
+#include "mpi_ops.h"
+#include "transporte_reducido.h"
+
+
+#define BYTES_CABECERA_PLANO 9  // modo (1 byte) + longitud (uint64)
+#define MODO_PLANO_CRUDO 0
+#define MODO_PLANO_RLE 1
+
+
+// ============================================================================
+// FORMATOS
+// ============================================================================
+
+
+const char* nombre_formato_transporte(FormatoTransporte formato) {
+   switch (formato) {
+       case TRANSPORTE_FP64: return "fp64";
+       case TRANSPORTE_FP32: return "fp32";
+       case TRANSPORTE_BF16: return "bf16";
+       case TRANSPORTE_SIN_PERDIDA: return "shuffle+RLE";
+       default: return "?";
+   }
+}
+
+
+/**
+ * Traduce el nombre de la línea de comandos (fp64, fp32, bf16 o
+ * sin-perdida). Devuelve false si no es ninguno.
+ */
+bool analizar_formato_transporte(const char* texto, FormatoTransporte* formato) {
+   static const char* nombres[NUM_FORMATOS_TRANSPORTE] = {"fp64", "fp32", "bf16", "sin-perdida"};
+   for (int f = 0; f < NUM_FORMATOS_TRANSPORTE; f++) {
+       if (strcmp(texto, nombres[f]) == 0) {
+           *formato = (FormatoTransporte)f;
+           return true;
+       }
+   }
+   return false;
+}
+
+
+/**
+ * fp64 y SIN_PERDIDA deben reproducir exactamente el resultado de
+ * referencia; fp32 y bf16 se aceptan si el error relativo queda bajo su
+ * tolerancia. error_relativo (puede ser NULL) recibe el error medido.
+ */
+bool verificar_con_formato(const double* C_referencia, const double* C, int n,
+                           FormatoTransporte formato, double* error_relativo) {
+   double error = calcular_error_relativo(C_referencia, C, n);
+   if (error_relativo) *error_relativo = error;
+
+   if (formato == TRANSPORTE_FP32) return error <= TOLERANCIA_RELATIVA_FP32;
+   if (formato == TRANSPORTE_BF16) return error <= TOLERANCIA_RELATIVA_BF16;
+   return verificar_correccion_matriz(C_referencia, C, n, TOLERANCIA_VERIFICACION);
+}
+
+
+static void contar_bytes(EstadisticasTransporte* estadisticas, double bytes_fp64, double bytes_enviados) {
+   if (!estadisticas) return;
+   estadisticas->bytes_fp64 += bytes_fp64;
+   estadisticas->bytes_enviados += bytes_enviados;
+}
+
+
+// ============================================================================
+// CONVERSIONES ESCALARES
+// ============================================================================
+
+
+static float bf16_a_float(uint16_t valor) {
+   uint32_t bits = (uint32_t)valor << 16;
+   float resultado;
+   memcpy(&resultado, &bits, sizeof(resultado));
+   return resultado;
+}
+
+
+/**
+ * Trunca un float a sus 16 bits altos redondeando al par más cercano.
+ */
+static uint16_t float_a_bf16(float valor) {
+   uint32_t bits;
+   memcpy(&bits, &valor, sizeof(bits));
+   bits += 0x7FFFu + ((bits >> 16) & 1u);
+   return (uint16_t)(bits >> 16);
+}
+
+
+// ============================================================================
+// CÓDEC SIN PÉRDIDA: BYTE-SHUFFLE + RLE POR PLANO
+// ============================================================================
+
+/*
+ * El plano p contiene el byte p de cada double. En datos reales los planos
+ * de signo/exponente son casi constantes y se comprimen bien con RLE; los de
+ * mantisa baja suelen ser ruido y viajan sin comprimir.
+ *
+ * RLE tipo PackBits: un byte de control c < 128 precede a c+1 literales;
+ * c >= 128 indica que el byte siguiente se repite c-126 veces (2..129).
+ */
+static unsigned char byte_plano(const unsigned char* bytes, size_t i, size_t plano) {
+   return bytes[i * sizeof(double) + plano];
+}
+
+
+/**
+ * Comprime un plano en salida. Devuelve SIZE_MAX si el resultado no es más
+ * corto que el plano sin comprimir.
+ */
+static size_t comprimir_plano(const unsigned char* bytes, size_t elementos, size_t plano,
+                              unsigned char* salida) {
+   size_t i = 0;
+   size_t o = 0;
+
+   while (i < elementos) {
+       unsigned char actual = byte_plano(bytes, i, plano);
+       size_t repeticion = 1;
+       while (i + repeticion < elementos && repeticion < 129
+              && byte_plano(bytes, i + repeticion, plano) == actual) {
+           repeticion++;
+       }
+
+       if (repeticion >= 2) {
+           if (o + 2 >= elementos) return SIZE_MAX;
+           salida[o++] = (unsigned char)(repeticion + 126);
+           salida[o++] = actual;
+           i += repeticion;
+           continue;
+       }
+
+       // Literales hasta que empiece una repetición o se llegue a 128
+       size_t inicio = i;
+       size_t literales = 0;
+       while (i < elementos && literales < 128) {
+           if (i + 1 < elementos && byte_plano(bytes, i + 1, plano) == byte_plano(bytes, i, plano)) break;
+           i++;
+           literales++;
+       }
+       if (o + 1 + literales >= elementos) return SIZE_MAX;
+       salida[o++] = (unsigned char)(literales - 1);
+       for (size_t k = 0; k < literales; k++) {
+           salida[o++] = byte_plano(bytes, inicio + k, plano);
+       }
+   }
+   return o;
+}
+
+
+static void descomprimir_plano(const unsigned char* entrada, size_t elementos, size_t plano,
+                               unsigned char* bytes) {
+   size_t i = 0;
+   while (i < elementos) {
+       unsigned char control = *entrada++;
+       if (control < 128) {
+           for (size_t k = 0; k <= control; k++) {
+               bytes[(i++) * sizeof(double) + plano] = *entrada++;
+           }
+       } else {
+           unsigned char valor = *entrada++;
+           for (size_t k = 0; k < (size_t)control - 126; k++) {
+               bytes[(i++) * sizeof(double) + plano] = valor;
+           }
+       }
+   }
+}
+
+
+static size_t codificar_sin_perdida(const double* origen, size_t elementos, unsigned char* destino) {
+   const unsigned char* bytes = (const unsigned char*)origen;
+   size_t o = 0;
+
+   for (size_t plano = 0; plano < sizeof(double); plano++) {
+       unsigned char* cabecera = destino + o;
+       unsigned char* datos = cabecera + BYTES_CABECERA_PLANO;
+
+       size_t longitud = comprimir_plano(bytes, elementos, plano, datos);
+       if (longitud == SIZE_MAX) {
+           cabecera[0] = MODO_PLANO_CRUDO;
+           for (size_t i = 0; i < elementos; i++) {
+               datos[i] = byte_plano(bytes, i, plano);
+           }
+           longitud = elementos;
+       } else {
+           cabecera[0] = MODO_PLANO_RLE;
+       }
+
+       uint64_t longitud64 = longitud;
+       memcpy(cabecera + 1, &longitud64, sizeof(longitud64));
+       o += BYTES_CABECERA_PLANO + longitud;
+   }
+   return o;
+}
+
+
+static void decodificar_sin_perdida(const unsigned char* origen, double* destino, size_t elementos) {
+   unsigned char* bytes = (unsigned char*)destino;
+
+   for (size_t plano = 0; plano < sizeof(double); plano++) {
+       uint64_t longitud;
+       memcpy(&longitud, origen + 1, sizeof(longitud));
+       const unsigned char* datos = origen + BYTES_CABECERA_PLANO;
+
+       if (origen[0] == MODO_PLANO_CRUDO) {
+           for (size_t i = 0; i < elementos; i++) {
+               bytes[i * sizeof(double) + plano] = datos[i];
+           }
+       } else {
+           descomprimir_plano(datos, elementos, plano, bytes);
+       }
+       origen = datos + longitud;
+   }
+}
+
+
+// ============================================================================
+// CODIFICACIÓN DE BLOQUES
+// ============================================================================
+
+/**
+ * Bytes máximos que puede ocupar un bloque de elementos codificado.
+ */
+size_t capacidad_codificada(size_t elementos, FormatoTransporte formato) {
+   switch (formato) {
+       case TRANSPORTE_FP32: return elementos * sizeof(float);
+       case TRANSPORTE_BF16: return elementos * sizeof(uint16_t);
+       case TRANSPORTE_SIN_PERDIDA: return sizeof(double) * (BYTES_CABECERA_PLANO + elementos);
+       default: return elementos * sizeof(double);
+   }
+}
+
+
+/**
+ * Codifica elementos doubles en destino (de al menos capacidad_codificada
+ * bytes). Devuelve los bytes escritos.
+ */
+size_t codificar_doubles(const double* origen, size_t elementos, FormatoTransporte formato,
+                         unsigned char* destino) {
+   switch (formato) {
+       case TRANSPORTE_FP32:
+           for (size_t i = 0; i < elementos; i++) {
+               float valor = (float)origen[i];
+               memcpy(destino + i * sizeof(float), &valor, sizeof(float));
+           }
+           return elementos * sizeof(float);
+
+       case TRANSPORTE_BF16:
+           for (size_t i = 0; i < elementos; i++) {
+               uint16_t valor = float_a_bf16((float)origen[i]);
+               memcpy(destino + i * sizeof(uint16_t), &valor, sizeof(uint16_t));
+           }
+           return elementos * sizeof(uint16_t);
+
+       case TRANSPORTE_SIN_PERDIDA:
+           return codificar_sin_perdida(origen, elementos, destino);
+
+       default:
+           if (elementos > 0) memcpy(destino, origen, elementos * sizeof(double));
+           return elementos * sizeof(double);
+   }
+}
+
+
+void decodificar_doubles(const unsigned char* origen, FormatoTransporte formato,
+                         double* destino, size_t elementos) {
+   switch (formato) {
+       case TRANSPORTE_FP32:
+           for (size_t i = 0; i < elementos; i++) {
+               float valor;
+               memcpy(&valor, origen + i * sizeof(float), sizeof(float));
+               destino[i] = valor;
+           }
+           break;
+
+       case TRANSPORTE_BF16:
+           for (size_t i = 0; i < elementos; i++) {
+               uint16_t valor;
+               memcpy(&valor, origen + i * sizeof(uint16_t), sizeof(uint16_t));
+               destino[i] = bf16_a_float(valor);
+           }
+           break;
+
+       case TRANSPORTE_SIN_PERDIDA:
+           decodificar_sin_perdida(origen, destino, elementos);
+           break;
+
+       default:
+           if (elementos > 0) memcpy(destino, origen, elementos * sizeof(double));
+           break;
+   }
+}
+
+
+// ============================================================================
+// TRANSFERENCIAS CODIFICADAS
+// ============================================================================
+
+/*
+ * Los bloques codificados se rellenan hasta un múltiplo de n bytes y viajan
+ * como un tipo contiguo de n bytes: igual que el tipo "fila" de mpi_grande,
+ * los conteos quedan acotados por ~8 * filas y no desbordan un int.
+ */
+
+static MPI_Datatype crear_tipo_unidad(int n) {
+   MPI_Datatype tipo;
+   MPI_Type_contiguous(n, MPI_BYTE, &tipo);
+   MPI_Type_commit(&tipo);
+   return tipo;
+}
+
+
+static int unidades_para(size_t bytes, int n) {
+   return (int)((bytes + (size_t)n - 1) / (size_t)n);
+}
+
+
+static void* reservar_memoria(size_t bytes, int rango) {
+   void* buffer = malloc(bytes > 0 ? bytes : 1);
+   if (!buffer) {
+       fprintf(stderr, "Proceso %d: Error en asignación de memoria\n", rango);
+       MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+   }
+   return buffer;
+}
+
+
+/**
+ * Difunde una matriz codificada desde el raíz.
+ */
+void difundir_codificada(const double* origen, double* destino, int n,
+                         FormatoTransporte formato, EstadisticasTransporte* estadisticas) {
+   int rango;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+   size_t elementos = (size_t)n * n;
+   double bytes_fp64 = (double)elementos * sizeof(double);
+
+   if (formato == TRANSPORTE_FP64) {
+       if (rango == 0) {
+           memcpy(destino, origen, elementos * sizeof(double));
+           contar_bytes(estadisticas, bytes_fp64, bytes_fp64);
+       }
+       bcast_grande(destino, elementos, 0);
+       return;
+   }
+
+   MPI_Datatype unidad = crear_tipo_unidad(n);
+
+   int unidades = 0;
+   unsigned char* buffer = NULL;
+   if (rango == 0) {
+       buffer = (unsigned char*)reservar_memoria(capacidad_codificada(elementos, formato) + n, rango);
+       unidades = unidades_para(codificar_doubles(origen, elementos, formato, buffer), n);
+       contar_bytes(estadisticas, bytes_fp64, (double)unidades * n);
+   }
+   MPI_Bcast(&unidades, 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+   if (rango != 0) {
+       buffer = (unsigned char*)reservar_memoria((size_t)unidades * n, rango);
+   }
+   MPI_Bcast(buffer, unidades, unidad, 0, MPI_COMM_WORLD);
+   decodificar_doubles(buffer, formato, destino, elementos);
+
+   free(buffer);
+   MPI_Type_free(&unidad);
+}
+
+
+/**
+ * MPI_Scatterv de bloques de filas codificados: el raíz codifica el bloque
+ * de cada proceso por separado y envía primero el número de unidades.
+ */
+void repartir_codificada(const double* A, double* A_local, const int* filas, const int* desplazamientos,
+                         int n, FormatoTransporte formato, EstadisticasTransporte* estadisticas) {
+   int rango, tamano;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+   MPI_Comm_size(MPI_COMM_WORLD, &tamano);
+   double bytes_fp64 = (double)n * n * sizeof(double);
+
+   if (formato == TRANSPORTE_FP64) {
+       if (rango == 0) contar_bytes(estadisticas, bytes_fp64, bytes_fp64);
+       scatterv_filas(A, filas, desplazamientos, A_local, n, 0);
+       return;
+   }
+
+   MPI_Datatype unidad = crear_tipo_unidad(n);
+   int* unidades = (int*)reservar_memoria(tamano * sizeof(int), rango);
+   int* desplazamientos_unidades = (int*)reservar_memoria(tamano * sizeof(int), rango);
+
+   unsigned char* envio = NULL;
+   if (rango == 0) {
+       size_t capacidad = 0;
+       for (int i = 0; i < tamano; i++) {
+           capacidad += capacidad_codificada((size_t)filas[i] * n, formato) + n;
+       }
+       envio = (unsigned char*)reservar_memoria(capacidad, rango);
+
+       int desplazamiento = 0;
+       for (int i = 0; i < tamano; i++) {
+           size_t bytes = codificar_doubles(A + (size_t)desplazamientos[i] * n, (size_t)filas[i] * n,
+                                            formato, envio + (size_t)desplazamiento * n);
+           unidades[i] = unidades_para(bytes, n);
+           desplazamientos_unidades[i] = desplazamiento;
+           desplazamiento += unidades[i];
+       }
+       contar_bytes(estadisticas, bytes_fp64, (double)desplazamiento * n);
+   }
+
+   int unidades_local = 0;
+   MPI_Scatter(unidades, 1, MPI_INT, &unidades_local, 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+   unsigned char* recepcion = (unsigned char*)reservar_memoria((size_t)unidades_local * n, rango);
+   MPI_Scatterv(envio, unidades, desplazamientos_unidades, unidad,
+                recepcion, unidades_local, unidad, 0, MPI_COMM_WORLD);
+   decodificar_doubles(recepcion, formato, A_local, (size_t)filas[rango] * n);
+
+   free(envio);
+   free(recepcion);
+   free(unidades);
+   free(desplazamientos_unidades);
+   MPI_Type_free(&unidad);
+}
+
+
+/**
+ * MPI_Gatherv de bloques de filas codificados hacia el raíz.
+ */
+void recolectar_codificada(const double* C_local, double* C, const int* filas, const int* desplazamientos,
+                           int n, FormatoTransporte formato, EstadisticasTransporte* estadisticas) {
+   int rango, tamano;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+   MPI_Comm_size(MPI_COMM_WORLD, &tamano);
+   double bytes_fp64 = (double)n * n * sizeof(double);
+
+   if (formato == TRANSPORTE_FP64) {
+       if (rango == 0) contar_bytes(estadisticas, bytes_fp64, bytes_fp64);
+       gatherv_filas(C_local, C, filas, desplazamientos, n, 0);
+       return;
+   }
+
+   MPI_Datatype unidad = crear_tipo_unidad(n);
+   size_t elementos_local = (size_t)filas[rango] * n;
+
+   unsigned char* envio = (unsigned char*)reservar_memoria(capacidad_codificada(elementos_local, formato) + n, rango);
+   int unidades_local = unidades_para(codificar_doubles(C_local, elementos_local, formato, envio), n);
+
+   int* unidades = (int*)reservar_memoria(tamano * sizeof(int), rango);
+   int* desplazamientos_unidades = (int*)reservar_memoria(tamano * sizeof(int), rango);
+   MPI_Gather(&unidades_local, 1, MPI_INT, unidades, 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+   unsigned char* recepcion = NULL;
+   if (rango == 0) {
+       int desplazamiento = 0;
+       for (int i = 0; i < tamano; i++) {
+           desplazamientos_unidades[i] = desplazamiento;
+           desplazamiento += unidades[i];
+       }
+       recepcion = (unsigned char*)reservar_memoria((size_t)desplazamiento * n, rango);
+       contar_bytes(estadisticas, bytes_fp64, (double)desplazamiento * n);
+   }
+
+   MPI_Gatherv(envio, unidades_local, unidad,
+               recepcion, unidades, desplazamientos_unidades, unidad, 0, MPI_COMM_WORLD);
+
+   if (rango == 0) {
+       for (int i = 0; i < tamano; i++) {
+           decodificar_doubles(recepcion + (size_t)desplazamientos_unidades[i] * n, formato,
+                               C + (size_t)desplazamientos[i] * n, (size_t)filas[i] * n);
+       }
+   }
+
+   free(envio);
+   free(recepcion);
+   free(unidades);
+   free(desplazamientos_unidades);
+   MPI_Type_free(&unidad);
+}
+
+
+static void sumar_bf16(void* entrada, void* entrada_salida, int* cuenta, MPI_Datatype* tipo) {
+   (void)tipo;
+   const uint16_t* a = (const uint16_t*)entrada;
+   uint16_t* b = (uint16_t*)entrada_salida;
+   for (int i = 0; i < *cuenta; i++) {
+       b[i] = float_a_bf16(bf16_a_float(a[i]) + bf16_a_float(b[i]));
+   }
+}
+
+
+/**
+ * MPI_Reduce (suma) de C en el formato indicado. fp32 usa MPI_FLOAT y bf16
+ * una operación de usuario sobre MPI_UINT16_T; un flujo comprimido no admite
+ * reducción elemento a elemento, así que SIN_PERDIDA reduce en fp64.
+ */
+void reducir_codificada(const double* C_local, double* C, int n,
+                        FormatoTransporte formato, EstadisticasTransporte* estadisticas) {
+   int rango;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+   size_t elementos = (size_t)n * n;
+   double bytes_fp64 = (double)elementos * sizeof(double);
+
+   if (formato != TRANSPORTE_FP32 && formato != TRANSPORTE_BF16) {
+       reduce_suma_grande(C_local, C, elementos, 0);
+       if (rango == 0) contar_bytes(estadisticas, bytes_fp64, bytes_fp64);
+       return;
+   }
+
+   size_t ancho = capacidad_codificada(1, formato);
+   unsigned char* envio = (unsigned char*)reservar_memoria(elementos * ancho, rango);
+   unsigned char* recepcion = rango == 0 ? (unsigned char*)reservar_memoria(elementos * ancho, rango) : NULL;
+   codificar_doubles(C_local, elementos, formato, envio);
+
+   MPI_Datatype tipo = formato == TRANSPORTE_FP32 ? MPI_FLOAT : MPI_UINT16_T;
+   MPI_Op operacion = MPI_SUM;
+   if (formato == TRANSPORTE_BF16) {
+       MPI_Op_create(sumar_bf16, 1, &operacion);
+   }
+
+   // Las operaciones no admiten tipos derivados: trozos de CONTEO_MAXIMO_MPI
+   for (size_t inicio = 0; inicio < elementos; inicio += CONTEO_MAXIMO_MPI) {
+       size_t restante = elementos - inicio;
+       int trozo = (int)(restante < CONTEO_MAXIMO_MPI ? restante : CONTEO_MAXIMO_MPI);
+       MPI_Reduce(envio + inicio * ancho, rango == 0 ? recepcion + inicio * ancho : NULL,
+                  trozo, tipo, operacion, 0, MPI_COMM_WORLD);
+   }
+
+   if (rango == 0) {
+       decodificar_doubles(recepcion, formato, C, elementos);
+       contar_bytes(estadisticas, bytes_fp64, (double)elementos * ancho);
+   }
+
+   if (formato == TRANSPORTE_BF16) {
+       MPI_Op_free(&operacion);
+   }
+   free(envio);
+   free(recepcion);
+}
+
+
+// ============================================================================
+// PRUEBAS
+// ============================================================================
+
+/**
+ * Ejecuta las estrategias Scatter y Broadcast de mpi_ops con cada formato
+ * de transporte e informa bytes ahorrados y error frente a la
+ * multiplicación secuencial (criterio de verificar_con_formato). Todos los
+ * procesos deben llamar a esta función; solo el raíz crea datos y verifica.
+ */
+bool comparar_transporte_reducido(int n) {
+   int rango;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rango);
+
+   double* A = NULL;
+   double* B = NULL;
+   double* C_secuencial = NULL;
+   double* C_mpi = NULL;
+   bool correcto = true;
+
+   if (rango == 0) {
+       printf("\n=== TRANSPORTE DE PRECISIÓN REDUCIDA - Matriz %dx%d ===\n", n, n);
+       A = crear_matriz(n);
+       B = crear_matriz(n);
+       C_secuencial = crear_matriz(n);
+       C_mpi = crear_matriz(n);
+       if (!A || !B || !C_secuencial || !C_mpi) {
+           fprintf(stderr, "Error: No se pudieron crear matrices para prueba\n");
+           MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+       }
+       llenar_matriz(A, n);
+       llenar_matriz(B, n);
+       multiplicar_matrices_secuencial(A, B, C_secuencial, n);
+       printf("%-12s %-10s %12s %14s %14s %8s %12s %8s\n", "Formato", "Estrategia", "Tiempo (s)",
+              "Bytes fp64", "Bytes red", "Ahorro", "Error rel.", "Exacta");
+   }
+
+   const char* nombres[] = {"Scatter", "Broadcast"};
+   void (*estrategias[])(const double*, const double*, double*, int,
+                         FormatoTransporte, EstadisticasTransporte*) = {
+       multiplicar_matrices_mpi_scatter_formato,
+       multiplicar_matrices_mpi_broadcast_formato
+   };
+
+   for (int f = 0; f < NUM_FORMATOS_TRANSPORTE; f++) {
+       FormatoTransporte formato = (FormatoTransporte)f;
+
+       for (int e = 0; e < 2; e++) {
+           EstadisticasTransporte t = {0.0, 0.0};
+
+           MPI_Barrier(MPI_COMM_WORLD);
+           double inicio = MPI_Wtime();
+           estrategias[e](A, B, C_mpi, n, formato, &t);
+           MPI_Barrier(MPI_COMM_WORLD);
+           double tiempo = MPI_Wtime() - inicio;
+
+           if (rango == 0) {
+               double error;
+               bool aceptada = verificar_con_formato(C_secuencial, C_mpi, n, formato, &error);
+               bool exacta = verificar_correccion_matriz(C_secuencial, C_mpi, n, TOLERANCIA_VERIFICACION);
+               correcto = correcto && aceptada;
+
+               double ahorro = t.bytes_fp64 > 0.0 ? 100.0 * (1.0 - t.bytes_enviados / t.bytes_fp64) : 0.0;
+               printf("%-12s %-10s %12.6f %14.0f %14.0f %7.1f%% %12.2e %8s %s\n",
+                      nombre_formato_transporte(formato), nombres[e], tiempo,
+                      t.bytes_fp64, t.bytes_enviados, ahorro, error,
+                      exacta ? "sí" : "no", aceptada ? "✓" : "✗");
+           }
+       }
+   }
+
+   if (rango == 0) {
+       liberar_matriz(A);
+       liberar_matriz(B);
+       liberar_matriz(C_secuencial);
+       liberar_matriz(C_mpi);
+   }
+
+   return correcto;
+}
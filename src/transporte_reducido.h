@@ -0,0 +1,95 @@
+#ifndef TRANSPORTE_REDUCIDO_H
+#define TRANSPORTE_REDUCIDO_H
+
+
+#include <stdbool.h>
+#include <stddef.h>
+
+
+// ============================================================================
+// CONFIGURACIÓN
+// ============================================================================
+#define TOLERANCIA_RELATIVA_FP32 1e-5
+#define TOLERANCIA_RELATIVA_BF16 2e-2
+
+
+// ============================================================================
+// TRANSPORTE DE PRECISIÓN REDUCIDA
+// ============================================================================
+
+/*
+ * Las matrices viajan por la red codificadas y se decodifican a double antes
+ * de calcular, así que el cómputo local sigue siendo en fp64:
+ *
+ *   FP64        sin codificar (referencia)
+ *   FP32        4 bytes por elemento, redondeo al más cercano
+ *   BF16        2 bytes por elemento (16 bits altos de fp32, redondeo par)
+ *   SIN_PERDIDA byte-shuffle (8 planos de bytes) + RLE tipo PackBits por plano;
+ *               un plano que no se comprime viaja tal cual
+ *
+ * Los bloques codificados se transfieren en unidades de n bytes, con lo que
+ * los conteos siguen expresándose en "filas" y caben en un int.
+ *
+ * El formato es un argumento de las estrategias Scatter y Broadcast de
+ * mpi_ops.h (multiplicar_matrices_mpi_*_formato) y se elige en la línea de
+ * comandos con --transporte fp64|fp32|bf16|sin-perdida.
+ */
+typedef enum {
+   TRANSPORTE_FP64,
+   TRANSPORTE_FP32,
+   TRANSPORTE_BF16,
+   TRANSPORTE_SIN_PERDIDA,
+   NUM_FORMATOS_TRANSPORTE
+} FormatoTransporte;
+
+
+typedef struct {
+   double bytes_fp64;      // Bytes que habría movido el transporte en fp64
+   double bytes_enviados;  // Bytes realmente transferidos con el formato usado
+} EstadisticasTransporte;
+
+
+const char* nombre_formato_transporte(FormatoTransporte formato);
+bool analizar_formato_transporte(const char* texto, FormatoTransporte* formato);
+bool verificar_con_formato(const double* C_referencia, const double* C, int n,
+                           FormatoTransporte formato, double* error_relativo);
+
+size_t capacidad_codificada(size_t elementos, FormatoTransporte formato);
+size_t codificar_doubles(const double* origen, size_t elementos, FormatoTransporte formato,
+                         unsigned char* destino);
+void decodificar_doubles(const unsigned char* origen, FormatoTransporte formato,
+                         double* destino, size_t elementos);
+
+
+// ============================================================================
+// TRANSFERENCIAS CODIFICADAS (colectivas)
+// ============================================================================
+
+/*
+ * Equivalentes de MPI_Bcast, MPI_Scatterv, MPI_Gatherv y MPI_Reduce por
+ * filas que envían los datos en el formato indicado; con TRANSPORTE_FP64
+ * usan directamente las transferencias de mpi_grande.h. Todos los procesos
+ * decodifican lo que reciben, así que calculan con los mismos valores
+ * aunque el formato tenga pérdida. estadisticas (puede ser NULL) solo se
+ * acumula en el raíz.
+ */
+
+void difundir_codificada(const double* origen, double* destino, int n,
+                         FormatoTransporte formato, EstadisticasTransporte* estadisticas);
+void repartir_codificada(const double* A, double* A_local, const int* filas, const int* desplazamientos,
+                         int n, FormatoTransporte formato, EstadisticasTransporte* estadisticas);
+void recolectar_codificada(const double* C_local, double* C, const int* filas, const int* desplazamientos,
+                           int n, FormatoTransporte formato, EstadisticasTransporte* estadisticas);
+void reducir_codificada(const double* C_local, double* C, int n,
+                        FormatoTransporte formato, EstadisticasTransporte* estadisticas);
+
+
+// ============================================================================
+// PRUEBAS
+// ============================================================================
+
+
+bool comparar_transporte_reducido(int n);
+
+
+#endif